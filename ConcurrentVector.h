@@ -0,0 +1,329 @@
+//
+// Created by Sebastian on 16.10.2026.
+//
+
+#ifndef VECTOR_CONCURRENTVECTOR_H
+#define VECTOR_CONCURRENTVECTOR_H
+
+#include "Vector.h"
+#include <array>
+#include <atomic>
+
+// Append only vector for many concurrent writers. Slots are claimed with an atomic cursor and live in
+// segments which double in size and never move, so appends don't lock and readers never see a relocation.
+// Elements become visible through size() in index order once every earlier slot has been constructed.
+// The allocator is called from the appending threads and has to be thread safe
+template<typename T, size_t FirstBlockSize = 64, typename Alloc = MallocAllocator<T>>
+class ConcurrentVector {
+    static_assert(FirstBlockSize > 0 && (FirstBlockSize & (FirstBlockSize - 1)) == 0,
+                  "First block size has to be a power of two");
+    static_assert(std::is_nothrow_move_constructible_v<T>,
+                  "Elements are moved into claimed slots, which must not fail");
+
+    using AllocTraits = std::allocator_traits<Alloc>;
+
+    static_assert(std::is_same_v<typename AllocTraits::value_type, T>, "Allocator value_type has to match T");
+
+    static constexpr size_t FirstBlockShift = std::countr_zero(FirstBlockSize);
+    static constexpr size_t MaxBlocks = std::numeric_limits<size_t>::digits - FirstBlockShift;
+
+    struct Segment {
+        T *elems;
+        // Set once the element in the slot is constructed
+        std::unique_ptr<std::atomic<bool>[]> constructed;
+    };
+
+    std::array<std::atomic<Segment *>, MaxBlocks> m_segments{};
+    // Next slot to claim
+    std::atomic<size_t> m_cursor{};
+    // All slots below are constructed and visible to readers
+    std::atomic<size_t> m_published{};
+    [[no_unique_address]] Alloc m_alloc{};
+
+    static constexpr size_t blockSize(size_t block) {
+        return FirstBlockSize << block;
+    }
+
+    static size_t blockOf(size_t index) {
+        return std::bit_width(index + FirstBlockSize) - 1 - FirstBlockShift;
+    }
+
+    static size_t offsetInBlock(size_t index, size_t block) {
+        return index + FirstBlockSize - blockSize(block);
+    }
+
+    // Racing threads may both allocate a segment, the loser frees its own again
+    Segment *ensureSegment(size_t block) {
+        Segment *segment = m_segments[block].load(std::memory_order_acquire);
+
+        if (segment) {
+            return segment;
+        }
+
+        auto fresh = std::make_unique<Segment>();
+        fresh->elems = AllocTraits::allocate(m_alloc, blockSize(block));
+
+        try {
+            fresh->constructed = std::make_unique<std::atomic<bool>[]>(blockSize(block));
+        } catch (...) {
+            AllocTraits::deallocate(m_alloc, fresh->elems, blockSize(block));
+            throw;
+        }
+
+        if (m_segments[block].compare_exchange_strong(segment, fresh.get(), std::memory_order_acq_rel,
+                                                      std::memory_order_acquire)) {
+            return fresh.release();
+        }
+
+        AllocTraits::deallocate(m_alloc, fresh->elems, blockSize(block));
+        return segment;
+    }
+
+    // The segment is allocated before the slot is claimed, so a failed allocation leaves no hole behind
+    std::pair<size_t, Segment *> claimSlot() {
+        size_t index = m_cursor.load(std::memory_order_relaxed);
+
+        while (true) {
+            Segment *segment = ensureSegment(blockOf(index));
+
+            // On failure index holds the slot another writer left for us
+            if (m_cursor.compare_exchange_weak(index, index + 1, std::memory_order_relaxed)) {
+                return {index, segment};
+            }
+        }
+    }
+
+    // Published by the thread which finishes the lowest pending slot, so a slow writer only delays the
+    // visibility of later elements, never their construction. Sequentially consistent flags make sure
+    // one of two writers finishing neighbouring slots always sees the other one
+    void publish() {
+        size_t published = m_published.load();
+
+        while (published < m_cursor.load()) {
+            const size_t block = blockOf(published);
+            Segment *segment = m_segments[block].load(std::memory_order_acquire);
+
+            if (!segment || !segment->constructed[offsetInBlock(published, block)].load()) {
+                return;
+            }
+
+            // On failure published holds the value another writer advanced it to
+            if (m_published.compare_exchange_weak(published, published + 1)) {
+                published++;
+            }
+        }
+    }
+
+    T *elemPtr(size_t index) const {
+        const size_t block = blockOf(index);
+        return m_segments[block].load(std::memory_order_acquire)->elems + offsetInBlock(index, block);
+    }
+
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = const T &;
+
+    // Iterates the elements published when begin() / end() were called
+    class const_iterator {
+        friend class ConcurrentVector;
+
+        const ConcurrentVector *m_owner{};
+        size_t m_index{};
+
+        const_iterator(const ConcurrentVector *owner, size_t index) : m_owner{owner}, m_index{index} {}
+
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = T;
+        using pointer = const T *;
+        using reference = const T &;
+
+        const_iterator() = default;
+
+        reference operator*() const {
+            return *m_owner->elemPtr(m_index);
+        }
+
+        pointer operator->() const {
+            return m_owner->elemPtr(m_index);
+        }
+
+        reference operator[](difference_type offset) const {
+            return *m_owner->elemPtr(m_index + offset);
+        }
+
+        const_iterator &operator++() {
+            m_index++;
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator temp = *this;
+            m_index++;
+            return temp;
+        }
+
+        const_iterator &operator--() {
+            m_index--;
+            return *this;
+        }
+
+        const_iterator operator--(int) {
+            const_iterator temp = *this;
+            m_index--;
+            return temp;
+        }
+
+        const_iterator &operator+=(difference_type offset) {
+            m_index += offset;
+            return *this;
+        }
+
+        const_iterator &operator-=(difference_type offset) {
+            m_index -= offset;
+            return *this;
+        }
+
+        friend const_iterator operator+(const_iterator iter, difference_type offset) {
+            return iter += offset;
+        }
+
+        friend const_iterator operator+(difference_type offset, const_iterator iter) {
+            return iter += offset;
+        }
+
+        friend const_iterator operator-(const_iterator iter, difference_type offset) {
+            return iter -= offset;
+        }
+
+        friend difference_type operator-(const const_iterator &lhs, const const_iterator &rhs) {
+            return (difference_type) lhs.m_index - (difference_type) rhs.m_index;
+        }
+
+        bool operator==(const const_iterator &rhs) const {
+            return m_index == rhs.m_index;
+        }
+
+        auto operator<=>(const const_iterator &rhs) const {
+            return m_index <=> rhs.m_index;
+        }
+    };
+
+    ConcurrentVector() = default;
+
+    explicit ConcurrentVector(size_t capacity) {
+        reserve(capacity);
+    }
+
+    // Shared between threads by reference, not meant to be copied or moved around
+    ConcurrentVector(const ConcurrentVector &) = delete;
+
+    ConcurrentVector &operator=(const ConcurrentVector &) = delete;
+
+    // Must not race with any other access
+    ~ConcurrentVector() {
+        const size_t elemCount = m_cursor.load(std::memory_order_acquire);
+
+        for (size_t block = 0; block < MaxBlocks; block++) {
+            Segment *segment = m_segments[block].load(std::memory_order_acquire);
+
+            if (!segment) {
+                continue;
+            }
+
+            const size_t blockBegin = blockSize(block) - FirstBlockSize;
+            const size_t blockElems = elemCount > blockBegin ? std::min(elemCount - blockBegin, blockSize(block)) : 0;
+
+            std::destroy_n(segment->elems, blockElems);
+            AllocTraits::deallocate(m_alloc, segment->elems, blockSize(block));
+            delete segment;
+        }
+    }
+
+    // Modifiers, safe to call from any number of threads. Returns the index of the new element,
+    // which the calling thread may access right away
+    template<typename... Args>
+    size_t emplace_back(Args &&... args) {
+        if constexpr (std::is_nothrow_constructible_v<T, Args...>) {
+            const auto [index, segment] = claimSlot();
+            const size_t offset = offsetInBlock(index, blockOf(index));
+
+            new(segment->elems + offset)T(std::forward<Args>(args)...);
+            segment->constructed[offset].store(true);
+            publish();
+
+            return index;
+        } else {
+            // Built before claiming a slot, so a throwing constructor can't leave a hole behind
+            T value(std::forward<Args>(args)...);
+            return emplace_back(std::move(value));
+        }
+    }
+
+    size_t push_back(const T &value) {
+        return emplace_back(value);
+    }
+
+    size_t push_back(T &&value) {
+        return emplace_back(std::move(value));
+    }
+
+    // Allocates the segments up front, can run concurrently with appends
+    void reserve(size_t capacity) {
+        for (size_t block = 0; block < MaxBlocks && blockSize(block) - FirstBlockSize < capacity; block++) {
+            ensureSegment(block);
+        }
+    }
+
+    // Element access, valid for indices below size() and indices returned to the calling thread
+    const T &operator[](size_t index) const {
+        return *elemPtr(index);
+    }
+
+    T &operator[](size_t index) {
+        return *elemPtr(index);
+    }
+
+    const T &at(size_t index) const {
+        if (index >= size()) {
+            throw std::out_of_range("Out of range");
+        }
+
+        return *elemPtr(index);
+    }
+
+    // Capacity
+    bool empty() const {
+        return size() == 0;
+    }
+
+    // Published elements, appends still under construction are not counted
+    size_t size() const {
+        return m_published.load(std::memory_order_acquire);
+    }
+
+    // Iterators
+    const_iterator begin() const {
+        return {this, 0};
+    }
+
+    const_iterator end() const {
+        return {this, size()};
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+};
+
+#endif //VECTOR_CONCURRENTVECTOR_H
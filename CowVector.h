@@ -0,0 +1,332 @@
+//
+// Created by Sebastian on 16.10.2026.
+//
+
+#ifndef VECTOR_COWVECTOR_H
+#define VECTOR_COWVECTOR_H
+
+#include "Vector.h"
+#include <atomic>
+
+// Copy on write Vector, copies share one reference counted buffer and the first mutation through a
+// shared copy duplicates it. Reads go through the const overloads, non-const element access counts as
+// a mutation. References obtained from a mutation are only valid until this CowVector gets copied.
+// Copies may be handed to other threads, a single CowVector object is not meant to be shared between threads
+template<typename T, typename Alloc = MallocAllocator<T>, GrowthPolicy Growth = GrowthFactor<3, 2>>
+class CowVector {
+public:
+    using VectorType = Vector<T, Alloc, Growth>;
+    using value_type = T;
+    using allocator_type = Alloc;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using iterator = typename VectorType::iterator;
+    using const_iterator = typename VectorType::const_iterator;
+
+private:
+    struct Shared {
+        VectorType vector;
+        // CowVectors referring to this buffer
+        std::atomic<long> owners{1};
+    };
+
+    // Empty until the first element, copies of empty CowVectors don't allocate
+    Shared *m_shared{};
+
+    static const VectorType &emptyVector() {
+        static const VectorType empty;
+        return empty;
+    }
+
+    const VectorType &shared() const {
+        return m_shared ? m_shared->vector : emptyVector();
+    }
+
+    // The last owner has to see every read the others made before letting go
+    static void releaseShared(Shared *shared) {
+        if (shared && shared->owners.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete shared;
+        }
+    }
+
+    void release() {
+        releaseShared(std::exchange(m_shared, nullptr));
+    }
+
+    // Buffer of one mutation. The buffer it was detached from is released only afterwards, arguments may point
+    // into it while another thread drops the last other copy
+    class Detached {
+        Shared *m_previous;
+
+    public:
+        VectorType &vector;
+
+        Detached(VectorType &vector, Shared *previous) : m_previous{previous}, vector{vector} {}
+
+        Detached(const Detached &) = delete;
+
+        Detached &operator=(const Detached &) = delete;
+
+        ~Detached() {
+            releaseShared(m_previous);
+        }
+    };
+
+    // Acquire pairs with the release of copies dropped on other threads, their reads happen before our writes
+    bool ownsBuffer() const {
+        return m_shared->owners.load(std::memory_order_acquire) == 1;
+    }
+
+    // Detaches from the other copies before the first write
+    Detached detach() {
+        Shared *previous = nullptr;
+
+        if (!m_shared) {
+            m_shared = new Shared{};
+        } else if (!ownsBuffer()) {
+            previous = m_shared;
+            m_shared = new Shared{VectorType(previous->vector)};
+        }
+
+        return {m_shared->vector, previous};
+    }
+
+    // For writes without arguments that could refer to the old buffer
+    VectorType &unshared() {
+        return detach().vector;
+    }
+
+    size_t indexOf(const_iterator pos) const {
+        return pos - cbegin();
+    }
+
+public:
+    CowVector() = default;
+
+    CowVector(std::initializer_list<T> values) : m_shared{new Shared{VectorType(values)}} {}
+
+    explicit CowVector(VectorType vector) : m_shared{new Shared{std::move(vector)}} {}
+
+    // Copies share the buffer, O(1)
+    CowVector(const CowVector &other) : m_shared{other.m_shared} {
+        if (m_shared) {
+            m_shared->owners.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    CowVector(CowVector &&other) noexcept: m_shared{std::exchange(other.m_shared, nullptr)} {}
+
+    CowVector &operator=(const CowVector &other) {
+        CowVector(other).swap(*this);
+        return *this;
+    }
+
+    CowVector &operator=(CowVector &&other) noexcept {
+        CowVector(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    ~CowVector() {
+        release();
+    }
+
+    void swap(CowVector &other) noexcept {
+        std::swap(m_shared, other.m_shared);
+    }
+
+    friend void swap(CowVector &lhs, CowVector &rhs) noexcept {
+        lhs.swap(rhs);
+    }
+
+    // Buffer shared with other copies, the next mutation copies it
+    bool is_shared() const {
+        return use_count() > 1;
+    }
+
+    long use_count() const {
+        return m_shared ? m_shared->owners.load(std::memory_order_relaxed) : 0;
+    }
+
+    // Read only view of the current contents
+    const VectorType &vector() const {
+        return shared();
+    }
+
+    // Modifiers, all of them detach a shared buffer first
+    void clear() {
+        // Nothing to copy when the contents get dropped anyway
+        if (m_shared && ownsBuffer()) {
+            m_shared->vector.clear();
+        } else {
+            release();
+        }
+    }
+
+    iterator insert(const_iterator pos, const T &value) {
+        const size_t index = indexOf(pos);
+        const Detached detached = detach();
+        VectorType &vector = detached.vector;
+
+        return vector.insert(vector.begin() + index, value);
+    }
+
+    iterator insert(const_iterator pos, size_t count, const T &value) {
+        const size_t index = indexOf(pos);
+        const Detached detached = detach();
+        VectorType &vector = detached.vector;
+
+        return vector.insert(vector.begin() + index, count, value);
+    }
+
+    iterator insert(const_iterator pos, T &&value) {
+        const size_t index = indexOf(pos);
+        const Detached detached = detach();
+        VectorType &vector = detached.vector;
+
+        return vector.insert(vector.begin() + index, std::move(value));
+    }
+
+    template<typename... Args>
+    iterator emplace(const_iterator pos, Args &&... args) {
+        const size_t index = indexOf(pos);
+        const Detached detached = detach();
+        VectorType &vector = detached.vector;
+
+        return vector.emplace(vector.begin() + index, std::forward<Args>(args)...);
+    }
+
+    iterator erase(const_iterator pos) {
+        const size_t index = indexOf(pos);
+        const Detached detached = detach();
+        VectorType &vector = detached.vector;
+
+        return vector.erase(vector.begin() + index);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        const size_t firstIndex = indexOf(first);
+        const size_t lastIndex = indexOf(last);
+        const Detached detached = detach();
+        VectorType &vector = detached.vector;
+
+        return vector.erase(vector.begin() + firstIndex, vector.begin() + lastIndex);
+    }
+
+    template<typename Predicate>
+    size_t erase_if(Predicate pred) {
+        return detach().vector.erase_if(std::move(pred));
+    }
+
+    // Arguments may refer to elements of the old buffer, which stays alive until the end of the expression
+    void push_back(const T &value) {
+        detach().vector.push_back(value);
+    }
+
+    void push_back(T &&value) {
+        detach().vector.push_back(std::move(value));
+    }
+
+    template<typename... Args>
+    T &emplace_back(Args &&... args) {
+        return detach().vector.emplace_back(std::forward<Args>(args)...);
+    }
+
+    void pop_back() {
+        if (empty()) {
+            return;
+        }
+
+        unshared().pop_back();
+    }
+
+    void resize(size_t count) {
+        unshared().resize(count);
+    }
+
+    void resize(size_t count, const T &value) {
+        detach().vector.resize(count, value);
+    }
+
+    // Element access, the non-const overloads detach
+    const T &at(size_t pos) const {
+        return shared().at(pos);
+    }
+
+    T &at(size_t pos) {
+        if (pos >= size()) {
+            throw std::out_of_range("Out of range");
+        }
+
+        return unshared()[pos];
+    }
+
+    const T &operator[](size_t index) const {
+        return shared().data()[index];
+    }
+
+    T &operator[](size_t index) {
+        return unshared()[index];
+    }
+
+    const T &front() const {
+        return shared().front();
+    }
+
+    const T &back() const {
+        return shared().back();
+    }
+
+    const T *data() const {
+        return shared().data();
+    }
+
+    T *data() {
+        return unshared().data();
+    }
+
+    // Capacity
+    bool empty() const {
+        return shared().empty();
+    }
+
+    size_t size() const {
+        return shared().size();
+    }
+
+    size_t capacity() const {
+        return shared().capacity();
+    }
+
+    void reserve(size_t newCapacity) {
+        unshared().reserve(newCapacity);
+    }
+
+    // Iterators, the non-const overloads detach
+    iterator begin() {
+        return unshared().begin();
+    }
+
+    iterator end() {
+        return unshared().end();
+    }
+
+    const_iterator begin() const {
+        return shared().begin();
+    }
+
+    const_iterator end() const {
+        return shared().end();
+    }
+
+    const_iterator cbegin() const {
+        return shared().cbegin();
+    }
+
+    const_iterator cend() const {
+        return shared().cend();
+    }
+};
+
+#endif //VECTOR_COWVECTOR_H
@@ -0,0 +1,112 @@
+//
+// Created by Sebastian on 16.10.2026.
+//
+
+#ifndef VECTOR_HUGEPAGEALLOCATOR_H
+#define VECTOR_HUGEPAGEALLOCATOR_H
+
+#include "Vector.h"
+#include <sys/mman.h>
+
+// Backs large buffers with 2 MiB pages to cut down TLB misses when scanning them. Tries explicit huge pages
+// (MAP_HUGETLB) first and falls back to a 2 MiB aligned mapping with transparent huge pages (MADV_HUGEPAGE).
+// Buffers smaller than a huge page come from malloc.
+template<typename T>
+class HugePageAllocator {
+private:
+    // Keeps the capacity to mapping size relation unambiguous for deallocate
+    static_assert(sizeof(T) <= (size_t{1} << 21), "Elements have to fit into a huge page");
+
+    MallocAllocator<T> m_smallAlloc;
+
+    static size_t mappingSize(size_t bytes) {
+        return (bytes + hugePageSize - 1) / hugePageSize * hugePageSize;
+    }
+
+    static void *mapHugePages(size_t size) {
+#ifdef MAP_HUGETLB
+        void *hugeMem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+        if (hugeMem != MAP_FAILED) {
+            return hugeMem;
+        }
+#endif
+        // No huge pages reserved, map with enough slack to cut out an aligned range
+        auto *mem = static_cast<uint8_t *>(mmap(nullptr, size + hugePageSize, PROT_READ | PROT_WRITE,
+                                                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+
+        if (mem == MAP_FAILED) {
+            return nullptr;
+        }
+
+        const size_t headSlack = (hugePageSize - (uintptr_t) mem % hugePageSize) % hugePageSize;
+
+        if (headSlack > 0) {
+            munmap(mem, headSlack);
+        }
+
+        munmap(mem + headSlack + size, hugePageSize - headSlack);
+        mem += headSlack;
+
+#ifdef MADV_HUGEPAGE
+        madvise(mem, size, MADV_HUGEPAGE);
+#endif
+        return mem;
+    }
+
+public:
+    using value_type = T;
+
+    static constexpr size_t hugePageSize = size_t{1} << 21;
+
+    HugePageAllocator() = default;
+
+    template<typename U>
+    HugePageAllocator(const HugePageAllocator<U> &) noexcept {}
+
+    AllocationResult<T *> allocate_at_least(size_t elemCount) {
+        if (elemCount > std::numeric_limits<size_t>::max() / 2 / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+
+        if (elemCount * sizeof(T) < hugePageSize) {
+            return {m_smallAlloc.allocate(elemCount), elemCount};
+        }
+
+        // The rest of the last huge page is handed out as capacity
+        const size_t size = mappingSize(elemCount * sizeof(T));
+        void *mem = mapHugePages(size);
+
+        if (mem == nullptr) {
+            throw std::bad_alloc();
+        }
+
+        return {static_cast<T *>(mem), size / sizeof(T)};
+    }
+
+    T *allocate(size_t elemCount) {
+        return allocate_at_least(elemCount).ptr;
+    }
+
+    void deallocate(T *ptr, size_t elemCount) noexcept {
+        if (elemCount * sizeof(T) < hugePageSize) {
+            m_smallAlloc.deallocate(ptr, elemCount);
+            return;
+        }
+
+        munmap(ptr, mappingSize(elemCount * sizeof(T)));
+    }
+
+    friend bool operator==(const HugePageAllocator &, const HugePageAllocator &) {
+        return true;
+    }
+
+    friend bool operator!=(const HugePageAllocator &, const HugePageAllocator &) {
+        return false;
+    }
+};
+
+template<typename T, GrowthPolicy Growth = GrowthFactor<3, 2>>
+using HugePageVector = Vector<T, HugePageAllocator<T>, Growth>;
+
+#endif //VECTOR_HUGEPAGEALLOCATOR_H
@@ -0,0 +1,366 @@
+//
+// Created by Sebastian on 16.10.2026.
+//
+
+#ifndef VECTOR_MAPPEDVECTOR_H
+#define VECTOR_MAPPEDVECTOR_H
+
+#include "Vector.h"
+#include "VectorSerialization.h"
+#include <string>
+#include <system_error>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Vector stored in a file mapped with MAP_SHARED. Opening only maps the file, pages are read lazily on first
+// access, so reopening large datasets costs no parsing. Growth extends the file with ftruncate and the
+// mapping with mremap, the element count lives in the serialization header in front of the elements.
+// Changes reach the file through the page cache, flush() waits until they are on disk
+template<typename T, GrowthPolicy Growth = GrowthFactor<3, 2>>
+class MappedVector {
+    static_assert(std::is_trivially_copyable_v<T>, "Mapped elements are stored as raw bytes");
+    static_assert(alignof(T) <= 64, "Elements start 64 bytes into the mapping");
+
+    // Same layout as serialized Vectors, a mapped file can be opened as a VectorView
+    static constexpr size_t DataOffset = VectorFileHeader::PayloadOffset;
+
+    int m_fd{-1};
+    uint8_t *m_mapping{};
+    size_t m_mappingBytes{};
+    size_t m_capacity{};
+
+    VectorFileHeader &header() const {
+        return *(VectorFileHeader *) m_mapping;
+    }
+
+    // Moved from vectors have no mapping and act as empty
+    T *elems() const {
+        return m_mapping ? (T *) (m_mapping + DataOffset) : nullptr;
+    }
+
+    static size_t pageSize() {
+        return (size_t) sysconf(_SC_PAGESIZE);
+    }
+
+    static void throwSystemError(const char *what) {
+        throw std::system_error(errno, std::generic_category(), what);
+    }
+
+    void mapFile(size_t fileBytes) {
+        void *mapping = mmap(nullptr, fileBytes, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+
+        if (mapping == MAP_FAILED) {
+            throwSystemError("Mapping vector file");
+        }
+
+        m_mapping = (uint8_t *) mapping;
+        m_mappingBytes = fileBytes;
+        m_capacity = (fileBytes - DataOffset) / sizeof(T);
+    }
+
+    // Whole pages, the capacity takes everything the file size allows
+    void resizeFile(size_t capacity) {
+        if (!m_mapping) {
+            throw std::runtime_error("No vector file mapped");
+        }
+
+        if (capacity > (std::numeric_limits<size_t>::max() - DataOffset) / 2 / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+
+        const size_t granularity = pageSize();
+        const size_t fileBytes = (DataOffset + capacity * sizeof(T) + granularity - 1) / granularity * granularity;
+
+        if (fileBytes == m_mappingBytes) {
+            return;
+        }
+
+        if (ftruncate(m_fd, (off_t) fileBytes) != 0) {
+            throwSystemError("Resizing vector file");
+        }
+
+        void *mapping = mremap(m_mapping, m_mappingBytes, fileBytes, MREMAP_MAYMOVE);
+
+        if (mapping == MAP_FAILED) {
+            const int error = errno;
+            // The old mapping is still intact, the file gets its old size back
+            (void) ftruncate(m_fd, (off_t) m_mappingBytes);
+            throw std::system_error(error, std::generic_category(), "Remapping vector file");
+        }
+
+        m_mapping = (uint8_t *) mapping;
+        m_mappingBytes = fileBytes;
+        m_capacity = (fileBytes - DataOffset) / sizeof(T);
+    }
+
+    void growIfNeeded(size_t additionalElems) {
+        const size_t required = size() + additionalElems;
+
+        if (required > m_capacity) {
+            resizeFile(Growth::nextCapacity(m_capacity, required, sizeof(T)));
+        }
+    }
+
+    void close() {
+        if (m_mapping) {
+            munmap(m_mapping, m_mappingBytes);
+        }
+
+        if (m_fd >= 0) {
+            ::close(m_fd);
+        }
+
+        m_fd = -1;
+        m_mapping = nullptr;
+        m_mappingBytes = 0;
+        m_capacity = 0;
+    }
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using iterator = T *;
+    using const_iterator = const T *;
+
+    // Opens the file or creates an empty one
+    explicit MappedVector(const std::string &path) {
+        m_fd = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+
+        if (m_fd < 0) {
+            throwSystemError("Opening vector file");
+        }
+
+        try {
+            struct stat fileStat{};
+
+            if (fstat(m_fd, &fileStat) != 0) {
+                throwSystemError("Reading vector file size");
+            }
+
+            size_t fileBytes = (size_t) fileStat.st_size;
+            const bool created = fileBytes == 0;
+
+            if (created) {
+                fileBytes = pageSize();
+
+                if (ftruncate(m_fd, (off_t) fileBytes) != 0) {
+                    throwSystemError("Resizing vector file");
+                }
+            } else if (fileBytes < DataOffset) {
+                throw std::runtime_error("Not a serialized vector");
+            }
+
+            mapFile(fileBytes);
+
+            if (created) {
+                header() = VectorFileHeader::describe<T>(0);
+            } else {
+                header().template validate<T>(fileBytes);
+
+                // Valid for readVector and VectorView, but the elements here always start at DataOffset
+                if (header().payloadOffset != DataOffset) {
+                    throw std::runtime_error("Serialized vector has an unsupported payload offset");
+                }
+            }
+        } catch (...) {
+            close();
+            throw;
+        }
+    }
+
+    MappedVector(const MappedVector &) = delete;
+
+    MappedVector &operator=(const MappedVector &) = delete;
+
+    MappedVector(MappedVector &&other) noexcept
+            : m_fd{std::exchange(other.m_fd, -1)}, m_mapping{std::exchange(other.m_mapping, nullptr)},
+              m_mappingBytes{std::exchange(other.m_mappingBytes, 0)}, m_capacity{std::exchange(other.m_capacity, 0)} {}
+
+    MappedVector &operator=(MappedVector &&other) noexcept {
+        if (this != &other) {
+            close();
+            m_fd = std::exchange(other.m_fd, -1);
+            m_mapping = std::exchange(other.m_mapping, nullptr);
+            m_mappingBytes = std::exchange(other.m_mappingBytes, 0);
+            m_capacity = std::exchange(other.m_capacity, 0);
+        }
+
+        return *this;
+    }
+
+    // Unmapping doesn't discard anything, the kernel writes dirty pages back on its own schedule
+    ~MappedVector() {
+        close();
+    }
+
+    // Writes the dirty pages back and waits for the disk
+    void flush() {
+        if (!m_mapping) {
+            return;
+        }
+
+        if (msync(m_mapping, m_mappingBytes, MS_SYNC) != 0) {
+            throwSystemError("Flushing vector file");
+        }
+    }
+
+    // Schedules the write back without waiting
+    void flush_async() {
+        if (!m_mapping) {
+            return;
+        }
+
+        if (msync(m_mapping, m_mappingBytes, MS_ASYNC) != 0) {
+            throwSystemError("Flushing vector file");
+        }
+    }
+
+    // Modifiers, the element is built first since growth may move the mapping
+    template<typename... Args>
+    T &emplace_back(Args &&... args) {
+        const T value(std::forward<Args>(args)...);
+        growIfNeeded(1);
+
+        T *elem = elems() + size();
+        std::memcpy((void *) elem, &value, sizeof(T));
+        header().elemCount++;
+
+        return *elem;
+    }
+
+    void push_back(const T &value) {
+        emplace_back(value);
+    }
+
+    void pop_back() {
+        if (empty()) {
+            return;
+        }
+
+        header().elemCount--;
+    }
+
+    // New elements get value initialized
+    void resize(size_t count) {
+        const size_t oldCount = size();
+        resize_for_overwrite(count);
+
+        if (count > oldCount) {
+            std::uninitialized_value_construct_n(elems() + oldCount, count - oldCount);
+        }
+    }
+
+    // New elements keep whatever the file holds, freshly extended files read as zero
+    void resize_for_overwrite(size_t count) {
+        if (count == size()) {
+            return;
+        }
+
+        if (count > size()) {
+            growIfNeeded(count - size());
+        }
+
+        header().elemCount = count;
+    }
+
+    void clear() {
+        if (m_mapping) {
+            header().elemCount = 0;
+        }
+    }
+
+    void reserve(size_t capacity) {
+        if (capacity > m_capacity) {
+            resizeFile(capacity);
+        }
+    }
+
+    // Truncates the file behind the last element
+    void shrink_to_fit() {
+        if (m_mapping) {
+            resizeFile(size());
+        }
+    }
+
+    // Element access
+    T &at(size_t index) const {
+        if (index >= size()) {
+            throw std::out_of_range("Out of range");
+        }
+
+        return elems()[index];
+    }
+
+    T &operator[](size_t index) {
+        return elems()[index];
+    }
+
+    const T &operator[](size_t index) const {
+        return elems()[index];
+    }
+
+    T &front() const {
+        return at(0);
+    }
+
+    T &back() const {
+        if (empty()) {
+            throw std::out_of_range("Container is empty");
+        }
+
+        return elems()[size() - 1];
+    }
+
+    T *data() {
+        return elems();
+    }
+
+    const T *data() const {
+        return elems();
+    }
+
+    // Capacity
+    bool empty() const {
+        return size() == 0;
+    }
+
+    size_t size() const {
+        return m_mapping ? header().elemCount : 0;
+    }
+
+    size_t capacity() const {
+        return m_capacity;
+    }
+
+    // Iterators
+    iterator begin() {
+        return elems();
+    }
+
+    iterator end() {
+        return elems() + size();
+    }
+
+    const_iterator begin() const {
+        return elems();
+    }
+
+    const_iterator end() const {
+        return elems() + size();
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+};
+
+#endif //VECTOR_MAPPEDVECTOR_H
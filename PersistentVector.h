@@ -0,0 +1,778 @@
+//
+// Created by Sebastian on 16.10.2026.
+//
+
+#ifndef VECTOR_PERSISTENTVECTOR_H
+#define VECTOR_PERSISTENTVECTOR_H
+
+#include "Vector.h"
+#include <atomic>
+
+// Immutable vector on a relaxed radix balanced tree (Bagwell & Rompf). Every update returns a new version
+// sharing all untouched nodes with the old one. Internal nodes keep cumulative subtree sizes, so slices and
+// concatenations can leave nodes partially filled while indexing stays a radix guess plus a short scan
+template<typename T>
+class PersistentVector {
+    static constexpr size_t Bits = 5;
+    static constexpr size_t Branching = size_t{1} << Bits;
+    // Concat only rebalances when more than Extras nodes above the optimum would be needed,
+    // nodes holding at least Branching - Extras / 2 items are left untouched
+    static constexpr size_t Extras = 2;
+
+    struct Node;
+    using NodePtr = std::shared_ptr<Node>;
+
+    struct Node {
+        // Leaves hold elements, internal nodes children and their cumulative sizes
+        Vector<T> elems;
+        Vector<NodePtr> children;
+        Vector<size_t> sizes;
+        // Transient which created the node and may edit it in place, 0 for nodes no one may edit
+        uint64_t edit{};
+    };
+
+    NodePtr m_root{};
+    size_t m_size{};
+    // Levels above the leaves times Bits
+    size_t m_shift{};
+
+    static size_t treeSize(const Node &node, size_t shift) {
+        return shift == 0 ? node.elems.size() : node.sizes.data()[node.sizes.size() - 1];
+    }
+
+    static size_t itemCount(const Node &node, size_t shift) {
+        return shift == 0 ? node.elems.size() : node.children.size();
+    }
+
+    // Children hold at most 1 << shift elements, so the radix guess never overshoots
+    static size_t findSlot(const Node &node, size_t shift, size_t index) {
+        size_t slot = index >> shift;
+
+        while (node.sizes.data()[slot] <= index) {
+            slot++;
+        }
+
+        return slot;
+    }
+
+    static void recomputeSizes(Node &node, size_t shift) {
+        size_t total = 0;
+        node.sizes.clear();
+
+        for (const NodePtr &child: node.children) {
+            total += treeSize(*child, shift - Bits);
+            node.sizes.push_back(total);
+        }
+    }
+
+    static NodePtr makeInternal(Vector<NodePtr> &&children, size_t shift) {
+        auto node = std::make_shared<Node>();
+        node->children = std::move(children);
+        recomputeSizes(*node, shift);
+
+        return node;
+    }
+
+    // Unique per Transient, a reference count can't tell whether another thread still reads a node
+    static uint64_t nextEditToken() {
+        static std::atomic<uint64_t> counter{0};
+        return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    // Nodes created by the editing Transient are edited in place, all others get copied first.
+    // Persistent updates pass 0 and copy exactly the path they touch
+    static Node &editable(NodePtr &node, uint64_t edit) {
+        if (edit == 0 || node->edit != edit) {
+            node = std::make_shared<Node>(*node);
+            node->edit = edit;
+        }
+
+        return *node;
+    }
+
+    static NodePtr newPath(size_t shift, T &&value, uint64_t edit) {
+        auto node = std::make_shared<Node>();
+        node->elems.push_back(std::move(value));
+        node->edit = edit;
+
+        for (size_t level = Bits; level <= shift; level += Bits) {
+            auto parent = std::make_shared<Node>();
+            parent->edit = edit;
+            parent->children.push_back(std::move(node));
+            parent->sizes.push_back(1);
+            node = std::move(parent);
+        }
+
+        return node;
+    }
+
+    const Node &leafAt(size_t index, size_t &leafBegin) const {
+        const Node *node = m_root.get();
+        leafBegin = index;
+
+        for (size_t shift = m_shift; shift > 0; shift -= Bits) {
+            const size_t slot = findSlot(*node, shift, index);
+
+            if (slot > 0) {
+                index -= node->sizes.data()[slot - 1];
+            }
+
+            node = node->children.data()[slot].get();
+        }
+
+        leafBegin -= index;
+        return *node;
+    }
+
+    static bool canPushBack(const Node &node, size_t shift) {
+        if (shift == 0) {
+            return node.elems.size() < Branching;
+        }
+
+        return node.children.size() < Branching || canPushBack(*node.children.data()[node.children.size() - 1],
+                                                               shift - Bits);
+    }
+
+    static void pushBackInto(NodePtr &node, size_t shift, T &&value, uint64_t edit) {
+        Node &edited = editable(node, edit);
+
+        if (shift == 0) {
+            edited.elems.push_back(std::move(value));
+            return;
+        }
+
+        NodePtr &last = edited.children.back();
+
+        if (canPushBack(*last, shift - Bits)) {
+            pushBackInto(last, shift - Bits, std::move(value), edit);
+            edited.sizes.back()++;
+        } else {
+            edited.children.push_back(newPath(shift - Bits, std::move(value), edit));
+            edited.sizes.push_back(edited.sizes.back() + 1);
+        }
+    }
+
+    void pushBackInPlace(T &&value, uint64_t edit) {
+        if (!m_root) {
+            m_root = newPath(0, std::move(value), edit);
+        } else if (canPushBack(*m_root, m_shift)) {
+            pushBackInto(m_root, m_shift, std::move(value), edit);
+        } else {
+            // Tree is full, grows by one level
+            Vector<NodePtr> children;
+            children.push_back(std::move(m_root));
+            children.push_back(newPath(m_shift, std::move(value), edit));
+
+            m_shift += Bits;
+            m_root = makeInternal(std::move(children), m_shift);
+            m_root->edit = edit;
+        }
+
+        m_size++;
+    }
+
+    void setInPlace(size_t index, T &&value, uint64_t edit) {
+        if (index >= m_size) {
+            throw std::out_of_range("Out of range");
+        }
+
+        NodePtr *node = &m_root;
+
+        for (size_t shift = m_shift; shift > 0; shift -= Bits) {
+            Node &edited = editable(*node, edit);
+            const size_t slot = findSlot(edited, shift, index);
+
+            if (slot > 0) {
+                index -= edited.sizes[slot - 1];
+            }
+
+            node = &edited.children[slot];
+        }
+
+        editable(*node, edit).elems[index] = std::move(value);
+    }
+
+    // First count elements of the subtree
+    static NodePtr takeFront(const NodePtr &node, size_t shift, size_t count) {
+        if (count == treeSize(*node, shift)) {
+            return node;
+        }
+
+        auto result = std::make_shared<Node>();
+
+        if (shift == 0) {
+            result->elems.append_range(std::span<const T>(node->elems.data(), count));
+            return result;
+        }
+
+        const size_t slot = findSlot(*node, shift, count - 1);
+        const size_t before = slot > 0 ? node->sizes.data()[slot - 1] : 0;
+
+        result->children.append_range(std::span<const NodePtr>(node->children.data(), slot));
+        result->children.push_back(takeFront(node->children.data()[slot], shift - Bits, count - before));
+        result->sizes.append_range(std::span<const size_t>(node->sizes.data(), slot));
+        result->sizes.push_back(count);
+
+        return result;
+    }
+
+    // Subtree without its first dropCount elements
+    static NodePtr dropFront(const NodePtr &node, size_t shift, size_t dropCount) {
+        if (dropCount == 0) {
+            return node;
+        }
+
+        auto result = std::make_shared<Node>();
+
+        if (shift == 0) {
+            result->elems.append_range(std::span<const T>(node->elems.data() + dropCount,
+                                                          node->elems.size() - dropCount));
+            return result;
+        }
+
+        const size_t slot = findSlot(*node, shift, dropCount);
+        const size_t before = slot > 0 ? node->sizes.data()[slot - 1] : 0;
+
+        result->children.push_back(dropFront(node->children.data()[slot], shift - Bits, dropCount - before));
+        result->children.append_range(std::span<const NodePtr>(node->children.data() + slot + 1,
+                                                               node->children.size() - slot - 1));
+
+        for (size_t i = slot; i < node->sizes.size(); i++) {
+            result->sizes.push_back(node->sizes.data()[i] - dropCount);
+        }
+
+        return result;
+    }
+
+    // Redistributes the items of neighbouring children at shift - Bits so concatenations don't degrade the tree.
+    // Returns one or two nodes at shift
+    static Vector<NodePtr> rebalance(Vector<NodePtr> &&children, size_t shift) {
+        const size_t childShift = shift - Bits;
+
+        Vector<size_t> plan;
+        size_t itemTotal = 0;
+
+        for (const NodePtr &child: children) {
+            plan.push_back(itemCount(*child, childShift));
+            itemTotal += plan.back();
+        }
+
+        const size_t optimalSlots = (itemTotal + Branching - 1) / Branching;
+        size_t slots = plan.size();
+        size_t i = 0;
+
+        while (slots > optimalSlots + Extras) {
+            while (plan[i] >= Branching - Extras / 2) {
+                i++;
+            }
+
+            // Items of slot i flow into the following slots until one of them has been absorbed completely
+            size_t remaining = plan[i];
+
+            while (remaining > 0) {
+                const size_t filled = std::min(remaining + plan[i + 1], Branching);
+                plan[i] = filled;
+                remaining = remaining + plan[i + 1] - filled;
+                i++;
+            }
+
+            for (size_t j = i; j + 1 < slots; j++) {
+                plan[j] = plan[j + 1];
+            }
+
+            slots--;
+            i--;
+        }
+
+        Vector<NodePtr> rebalanced;
+        size_t child = 0;
+        size_t offset = 0;
+
+        for (size_t slot = 0; slot < slots; slot++) {
+            const size_t wanted = plan[slot];
+
+            // Untouched children are shared, not copied
+            if (offset == 0 && itemCount(*children[child], childShift) == wanted) {
+                rebalanced.push_back(children[child]);
+                child++;
+                continue;
+            }
+
+            auto node = std::make_shared<Node>();
+            size_t taken = 0;
+
+            while (taken < wanted) {
+                const Node &source = *children[child];
+                const size_t sourceCount = itemCount(source, childShift);
+                const size_t count = std::min(wanted - taken, sourceCount - offset);
+
+                if (childShift == 0) {
+                    node->elems.append_range(std::span<const T>(source.elems.data() + offset, count));
+                } else {
+                    node->children.append_range(std::span<const NodePtr>(source.children.data() + offset, count));
+                }
+
+                taken += count;
+                offset += count;
+
+                if (offset == sourceCount) {
+                    child++;
+                    offset = 0;
+                }
+            }
+
+            if (childShift > 0) {
+                recomputeSizes(*node, childShift);
+            }
+
+            rebalanced.push_back(std::move(node));
+        }
+
+        if (rebalanced.size() <= Branching) {
+            return Vector<NodePtr>{makeInternal(std::move(rebalanced), shift)};
+        }
+
+        Vector<NodePtr> first;
+        Vector<NodePtr> second;
+        first.append_range(std::span<const NodePtr>(rebalanced.data(), Branching));
+        second.append_range(std::span<const NodePtr>(rebalanced.data() + Branching, rebalanced.size() - Branching));
+
+        return Vector<NodePtr>{makeInternal(std::move(first), shift), makeInternal(std::move(second), shift)};
+    }
+
+    // Merges the right edge of left with the left edge of right, returns one or two nodes at the taller shift
+    static Vector<NodePtr> concatSubTree(const NodePtr &left, size_t leftShift, const NodePtr &right,
+                                         size_t rightShift) {
+        Vector<NodePtr> children;
+
+        if (leftShift > rightShift) {
+            const size_t leftCount = left->children.size();
+            children.append_range(std::span<const NodePtr>(left->children.data(), leftCount - 1));
+            children.append_range(concatSubTree(left->children.data()[leftCount - 1], leftShift - Bits, right,
+                                                rightShift));
+
+            return rebalance(std::move(children), leftShift);
+        }
+
+        if (leftShift < rightShift) {
+            const size_t rightCount = right->children.size();
+            children.append_range(concatSubTree(left, leftShift, right->children.data()[0], rightShift - Bits));
+            children.append_range(std::span<const NodePtr>(right->children.data() + 1, rightCount - 1));
+
+            return rebalance(std::move(children), rightShift);
+        }
+
+        if (leftShift == 0) {
+            if (left->elems.size() + right->elems.size() > Branching) {
+                return Vector<NodePtr>{left, right};
+            }
+
+            auto leaf = std::make_shared<Node>();
+            leaf->elems.append_range(std::span<const T>(left->elems.data(), left->elems.size()));
+            leaf->elems.append_range(std::span<const T>(right->elems.data(), right->elems.size()));
+
+            return Vector<NodePtr>{leaf};
+        }
+
+        const size_t leftCount = left->children.size();
+        const size_t rightCount = right->children.size();
+
+        children.append_range(std::span<const NodePtr>(left->children.data(), leftCount - 1));
+        children.append_range(concatSubTree(left->children.data()[leftCount - 1], leftShift - Bits,
+                                            right->children.data()[0], rightShift - Bits));
+        children.append_range(std::span<const NodePtr>(right->children.data() + 1, rightCount - 1));
+
+        return rebalance(std::move(children), leftShift);
+    }
+
+    void collapseRoot() {
+        while (m_shift > 0 && m_root->children.size() == 1) {
+            NodePtr child = m_root->children[0];
+            m_root = std::move(child);
+            m_shift -= Bits;
+        }
+    }
+
+    template<typename Func>
+    static void forEachLeaf(const Node &node, size_t shift, Func &func) {
+        if (shift == 0) {
+            func(node);
+            return;
+        }
+
+        for (const NodePtr &child: node.children) {
+            forEachLeaf(*child, shift - Bits, func);
+        }
+    }
+
+    // Full leaves built bottom up, O(n) with bulk copies into each leaf
+    void build(const T *elems, size_t count) {
+        if (count == 0) {
+            return;
+        }
+
+        Vector<NodePtr> level;
+
+        for (size_t offset = 0; offset < count; offset += Branching) {
+            auto leaf = std::make_shared<Node>();
+            leaf->elems.append_range(std::span<const T>(elems + offset, std::min(Branching, count - offset)));
+            level.push_back(std::move(leaf));
+        }
+
+        size_t shift = 0;
+
+        while (level.size() > 1) {
+            shift += Bits;
+            Vector<NodePtr> parents;
+
+            for (size_t offset = 0; offset < level.size(); offset += Branching) {
+                Vector<NodePtr> children;
+                children.append_range(std::span<const NodePtr>(level.data() + offset,
+                                                               std::min(Branching, level.size() - offset)));
+                parents.push_back(makeInternal(std::move(children), shift));
+            }
+
+            level = std::move(parents);
+        }
+
+        m_root = level[0];
+        m_size = count;
+        m_shift = shift;
+    }
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = const T &;
+    using const_reference = const T &;
+
+    // Read only, caches the current leaf so sequential iteration only walks the tree once per leaf
+    class const_iterator {
+        friend class PersistentVector;
+
+        const PersistentVector *m_owner{};
+        size_t m_index{};
+        const T *m_leaf{};
+        size_t m_leafBegin{};
+        size_t m_leafEnd{};
+
+        const_iterator(const PersistentVector *owner, size_t index) : m_owner{owner}, m_index{index} {
+            locate();
+        }
+
+        void locate() {
+            if ((m_index >= m_leafBegin && m_index < m_leafEnd) || m_index >= m_owner->m_size) {
+                return;
+            }
+
+            const Node &leaf = m_owner->leafAt(m_index, m_leafBegin);
+            m_leaf = leaf.elems.data();
+            m_leafEnd = m_leafBegin + leaf.elems.size();
+        }
+
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = T;
+        using pointer = const T *;
+        using reference = const T &;
+
+        const_iterator() = default;
+
+        reference operator*() const {
+            return m_leaf[m_index - m_leafBegin];
+        }
+
+        pointer operator->() const {
+            return m_leaf + (m_index - m_leafBegin);
+        }
+
+        reference operator[](difference_type offset) const {
+            return *(*this + offset);
+        }
+
+        const_iterator &operator++() {
+            m_index++;
+            locate();
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        const_iterator &operator--() {
+            m_index--;
+            locate();
+            return *this;
+        }
+
+        const_iterator operator--(int) {
+            const_iterator temp = *this;
+            --*this;
+            return temp;
+        }
+
+        const_iterator &operator+=(difference_type offset) {
+            m_index += offset;
+            locate();
+            return *this;
+        }
+
+        const_iterator &operator-=(difference_type offset) {
+            m_index -= offset;
+            locate();
+            return *this;
+        }
+
+        friend const_iterator operator+(const_iterator iter, difference_type offset) {
+            return iter += offset;
+        }
+
+        friend const_iterator operator+(difference_type offset, const_iterator iter) {
+            return iter += offset;
+        }
+
+        friend const_iterator operator-(const_iterator iter, difference_type offset) {
+            return iter -= offset;
+        }
+
+        friend difference_type operator-(const const_iterator &lhs, const const_iterator &rhs) {
+            return (difference_type) lhs.m_index - (difference_type) rhs.m_index;
+        }
+
+        bool operator==(const const_iterator &rhs) const {
+            return m_index == rhs.m_index;
+        }
+
+        auto operator<=>(const const_iterator &rhs) const {
+            return m_index <=> rhs.m_index;
+        }
+    };
+
+    using iterator = const_iterator;
+
+    // Mutable builder for batches of updates, edits the nodes it created in place instead of copying
+    // a path per update. Nodes of persistent versions are copied once. Not copyable, two copies would
+    // edit the same nodes
+    class Transient {
+        friend class PersistentVector;
+
+        PersistentVector m_tree;
+        uint64_t m_edit{nextEditToken()};
+
+    public:
+        Transient() = default;
+
+        Transient(const Transient &) = delete;
+
+        Transient(Transient &&other) noexcept = default;
+
+        Transient &operator=(const Transient &) = delete;
+
+        Transient &operator=(Transient &&other) noexcept = default;
+
+        void push_back(T value) {
+            m_tree.pushBackInPlace(std::move(value), m_edit);
+        }
+
+        void set(size_t index, T value) {
+            m_tree.setInPlace(index, std::move(value), m_edit);
+        }
+
+        const T &operator[](size_t index) const {
+            return m_tree[index];
+        }
+
+        size_t size() const {
+            return m_tree.size();
+        }
+
+        // Ends the batch, the transient is empty afterwards. The returned nodes may be read by other
+        // threads, so they are never edited in place again
+        PersistentVector persistent() {
+            m_edit = nextEditToken();
+            return std::move(m_tree);
+        }
+    };
+
+    PersistentVector() = default;
+
+    PersistentVector(std::initializer_list<T> values) {
+        build(values.begin(), values.size());
+    }
+
+    template<typename Alloc, GrowthPolicy Growth, StatsPolicy Stats>
+    explicit PersistentVector(const Vector<T, Alloc, Growth, Stats> &vector) {
+        build(vector.data(), vector.size());
+    }
+
+    PersistentVector(const PersistentVector &other) = default;
+
+    PersistentVector(PersistentVector &&other) noexcept
+            : m_root{std::move(other.m_root)}, m_size{std::exchange(other.m_size, 0)},
+              m_shift{std::exchange(other.m_shift, 0)} {}
+
+    PersistentVector &operator=(const PersistentVector &other) = default;
+
+    PersistentVector &operator=(PersistentVector &&other) noexcept {
+        m_root = std::move(other.m_root);
+        m_size = std::exchange(other.m_size, 0);
+        m_shift = std::exchange(other.m_shift, 0);
+
+        return *this;
+    }
+
+    ~PersistentVector() = default;
+
+    Transient transient() const {
+        Transient transient;
+        transient.m_tree = *this;
+
+        return transient;
+    }
+
+    // Leaf by leaf bulk copy
+    template<typename VectorType = Vector<T>>
+    VectorType toVector() const {
+        VectorType result;
+
+        if (!m_root) {
+            return result;
+        }
+
+        result.reserve(m_size);
+        auto appendLeaf = [&result](const Node &leaf) {
+            result.append_range(std::span<const T>(leaf.elems.data(), leaf.elems.size()));
+        };
+        forEachLeaf(*m_root, m_shift, appendLeaf);
+
+        return result;
+    }
+
+    // Updates, all of them leave this version untouched
+    [[nodiscard]] PersistentVector push_back(T value) const {
+        PersistentVector result = *this;
+        result.pushBackInPlace(std::move(value), 0);
+
+        return result;
+    }
+
+    [[nodiscard]] PersistentVector set(size_t index, T value) const {
+        PersistentVector result = *this;
+        result.setInPlace(index, std::move(value), 0);
+
+        return result;
+    }
+
+    // Elements [from, to)
+    [[nodiscard]] PersistentVector slice(size_t from, size_t to) const {
+        if (from > to || to > m_size) {
+            throw std::out_of_range("Out of range");
+        }
+
+        PersistentVector result;
+
+        if (from == to) {
+            return result;
+        }
+
+        NodePtr root = takeFront(m_root, m_shift, to);
+        result.m_root = dropFront(root, m_shift, from);
+        result.m_size = to - from;
+        result.m_shift = m_shift;
+        result.collapseRoot();
+
+        return result;
+    }
+
+    [[nodiscard]] PersistentVector concat(const PersistentVector &other) const {
+        if (other.empty()) {
+            return *this;
+        }
+
+        if (empty()) {
+            return other;
+        }
+
+        Vector<NodePtr> nodes = concatSubTree(m_root, m_shift, other.m_root, other.m_shift);
+
+        PersistentVector result;
+        result.m_size = m_size + other.m_size;
+        result.m_shift = std::max(m_shift, other.m_shift);
+
+        if (nodes.size() == 1) {
+            result.m_root = std::move(nodes[0]);
+        } else {
+            result.m_shift += Bits;
+            result.m_root = makeInternal(std::move(nodes), result.m_shift);
+        }
+
+        return result;
+    }
+
+    // Element access
+    const T &at(size_t index) const {
+        if (index >= m_size) {
+            throw std::out_of_range("Out of range");
+        }
+
+        return (*this)[index];
+    }
+
+    const T &operator[](size_t index) const {
+        size_t leafBegin;
+        const Node &leaf = leafAt(index, leafBegin);
+
+        return leaf.elems.data()[index - leafBegin];
+    }
+
+    const T &front() const {
+        return at(0);
+    }
+
+    const T &back() const {
+        if (m_size == 0) {
+            throw std::out_of_range("Container is empty");
+        }
+
+        return (*this)[m_size - 1];
+    }
+
+    // Capacity
+    bool empty() const {
+        return m_size == 0;
+    }
+
+    size_t size() const {
+        return m_size;
+    }
+
+    // Levels above the leaves
+    size_t height() const {
+        return m_shift / Bits;
+    }
+
+    // Iterators
+    const_iterator begin() const {
+        return {this, 0};
+    }
+
+    const_iterator end() const {
+        return {this, m_size};
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+};
+
+#endif //VECTOR_PERSISTENTVECTOR_H
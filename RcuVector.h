@@ -0,0 +1,330 @@
+//
+// Created by Sebastian on 16.10.2026.
+//
+
+#ifndef VECTOR_RCUVECTOR_H
+#define VECTOR_RCUVECTOR_H
+
+#include "Vector.h"
+#include <array>
+#include <atomic>
+
+// Vector for one writer thread and many reader threads which never block. Growth copies the elements
+// into a new buffer, publishes it atomically and retires the old one, which is only freed once no reader
+// can still hold it (epoch based reclamation). Readers register once and pin the current buffer per scan
+template<typename T, size_t MaxReaders = 64, typename Alloc = MallocAllocator<T>,
+        GrowthPolicy Growth = GrowthFactor<3, 2>>
+class RcuVector {
+    static_assert(std::is_copy_constructible_v<T>, "Readers may still use the old buffer, growth has to copy");
+
+    using AllocTraits = std::allocator_traits<Alloc>;
+
+    static_assert(std::is_same_v<typename AllocTraits::value_type, T>, "Allocator value_type has to match T");
+
+    struct Buffer {
+        T *elems{};
+        size_t capacity{};
+        // Elements below are constructed, published after construction
+        std::atomic<size_t> size{};
+    };
+
+    struct Retired {
+        Buffer *buffer;
+        uint64_t epoch;
+    };
+
+    // Own cache line each, readers only ever write their own slot
+    struct alignas(64) ReaderSlot {
+        std::atomic<bool> registered;
+        // Epoch announced while pinned, 0 when the reader holds no buffer
+        std::atomic<uint64_t> epoch;
+    };
+
+    std::atomic<Buffer *> m_buffer{};
+    // Starts at 1, so 0 can mark unpinned slots
+    std::atomic<uint64_t> m_epoch{1};
+    std::array<ReaderSlot, MaxReaders> m_readers{};
+    // Only touched by the writer
+    Vector<Retired> m_retired;
+    [[no_unique_address]] Alloc m_alloc{};
+
+    Buffer *currentBuffer() const {
+        return m_buffer.load(std::memory_order_relaxed);
+    }
+
+    Buffer *allocateBuffer(size_t capacity) {
+        auto buffer = std::make_unique<Buffer>();
+
+        if (capacity > 0) {
+            buffer->elems = AllocTraits::allocate(m_alloc, capacity);
+            buffer->capacity = capacity;
+        }
+
+        return buffer.release();
+    }
+
+    void freeBuffer(Buffer *buffer) {
+        std::destroy_n(buffer->elems, buffer->size.load(std::memory_order_relaxed));
+
+        if (buffer->elems) {
+            AllocTraits::deallocate(m_alloc, buffer->elems, buffer->capacity);
+        }
+
+        delete buffer;
+    }
+
+    // The copy is built completely before any reader can see it
+    Buffer *copyToNewBuffer(const Buffer &buffer, size_t capacity) {
+        Buffer *newBuffer = allocateBuffer(capacity);
+        const size_t elemCount = buffer.size.load(std::memory_order_relaxed);
+
+        try {
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                if (elemCount > 0) {
+                    std::memcpy((void *) newBuffer->elems, (const void *) buffer.elems, elemCount * sizeof(T));
+                }
+            } else {
+                std::uninitialized_copy_n(buffer.elems, elemCount, newBuffer->elems);
+            }
+        } catch (...) {
+            freeBuffer(newBuffer);
+            throw;
+        }
+
+        newBuffer->size.store(elemCount, std::memory_order_relaxed);
+        return newBuffer;
+    }
+
+    // Readers which loaded the old buffer announced an epoch of at most the one it is retired with
+    void publishBuffer(Buffer *newBuffer) {
+        Buffer *oldBuffer = m_buffer.exchange(newBuffer);
+        m_retired.push_back({oldBuffer, m_epoch.fetch_add(1)});
+        reclaim();
+    }
+
+    size_t nextCapacity(size_t requiredCapacity) const {
+        return Growth::nextCapacity(currentBuffer()->capacity, requiredCapacity, sizeof(T));
+    }
+
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+    using size_type = size_t;
+    using const_reference = const T &;
+
+    // Snapshot of the elements published when it was taken, keeps the buffer alive until destroyed.
+    // Not copyable, a reader holds at most one at a time
+    class ReadGuard {
+        friend class RcuVector;
+
+        const Buffer *m_buffer;
+        size_t m_size;
+        ReaderSlot *m_slot;
+
+        ReadGuard(const Buffer *buffer, ReaderSlot *slot)
+                : m_buffer{buffer}, m_size{buffer->size.load(std::memory_order_acquire)}, m_slot{slot} {}
+
+    public:
+        ReadGuard(const ReadGuard &) = delete;
+
+        ReadGuard &operator=(const ReadGuard &) = delete;
+
+        ~ReadGuard() {
+            m_slot->epoch.store(0, std::memory_order_release);
+        }
+
+        size_t size() const {
+            return m_size;
+        }
+
+        bool empty() const {
+            return m_size == 0;
+        }
+
+        const T &operator[](size_t index) const {
+            return m_buffer->elems[index];
+        }
+
+        const T &at(size_t index) const {
+            if (index >= m_size) {
+                throw std::out_of_range("Out of range");
+            }
+
+            return m_buffer->elems[index];
+        }
+
+        const T *data() const {
+            return m_buffer->elems;
+        }
+
+        const T *begin() const {
+            return m_buffer->elems;
+        }
+
+        const T *end() const {
+            return m_buffer->elems + m_size;
+        }
+    };
+
+    // Registration of one reader thread, owns a slot until destroyed
+    class Reader {
+        friend class RcuVector;
+
+        RcuVector *m_owner;
+        ReaderSlot *m_slot;
+
+        Reader(RcuVector *owner, ReaderSlot *slot) : m_owner{owner}, m_slot{slot} {}
+
+    public:
+        Reader(Reader &&other) noexcept
+                : m_owner{std::exchange(other.m_owner, nullptr)}, m_slot{std::exchange(other.m_slot, nullptr)} {}
+
+        Reader(const Reader &) = delete;
+
+        Reader &operator=(const Reader &) = delete;
+
+        ~Reader() {
+            if (m_slot) {
+                m_slot->registered.store(false, std::memory_order_release);
+            }
+        }
+
+        // Announces the epoch before loading the buffer, a buffer retired afterwards stays alive
+        ReadGuard pin() const {
+            assert(m_slot->epoch.load(std::memory_order_relaxed) == 0 && "Reader is already pinned");
+
+            m_slot->epoch.store(m_owner->m_epoch.load());
+            return ReadGuard{m_owner->m_buffer.load(), m_slot};
+        }
+    };
+
+    RcuVector() {
+        m_buffer.store(allocateBuffer(0));
+    }
+
+    explicit RcuVector(size_t capacity) {
+        m_buffer.store(allocateBuffer(capacity));
+    }
+
+    RcuVector(const RcuVector &) = delete;
+
+    RcuVector &operator=(const RcuVector &) = delete;
+
+    // Readers have to be gone
+    ~RcuVector() {
+        for (const Retired &retired: m_retired) {
+            freeBuffer(retired.buffer);
+        }
+
+        freeBuffer(currentBuffer());
+    }
+
+    // Any thread, throws when all MaxReaders slots are taken
+    Reader register_reader() {
+        for (ReaderSlot &slot: m_readers) {
+            bool registered = false;
+
+            if (slot.registered.compare_exchange_strong(registered, true, std::memory_order_acquire)) {
+                return Reader{this, &slot};
+            }
+        }
+
+        throw std::length_error("Too many readers");
+    }
+
+    // Writer side, only one thread at a time
+    template<typename... Args>
+    T &emplace_back(Args &&... args) {
+        Buffer *buffer = currentBuffer();
+        const size_t elemCount = buffer->size.load(std::memory_order_relaxed);
+
+        if (elemCount < buffer->capacity) {
+            T *elem = new(buffer->elems + elemCount)T(std::forward<Args>(args)...);
+            buffer->size.store(elemCount + 1, std::memory_order_release);
+
+            return *elem;
+        }
+
+        // Arguments may refer to elements of the old buffer, which stays alive until retired
+        Buffer *newBuffer = copyToNewBuffer(*buffer, nextCapacity(elemCount + 1));
+        T *elem;
+
+        try {
+            elem = new(newBuffer->elems + elemCount)T(std::forward<Args>(args)...);
+        } catch (...) {
+            freeBuffer(newBuffer);
+            throw;
+        }
+
+        newBuffer->size.store(elemCount + 1, std::memory_order_relaxed);
+        publishBuffer(newBuffer);
+
+        return *elem;
+    }
+
+    void push_back(const T &value) {
+        emplace_back(value);
+    }
+
+    void push_back(T &&value) {
+        emplace_back(std::move(value));
+    }
+
+    void reserve(size_t capacity) {
+        if (capacity > currentBuffer()->capacity) {
+            publishBuffer(copyToNewBuffer(*currentBuffer(), capacity));
+        }
+    }
+
+    // Readers still scanning keep seeing the old elements
+    void clear() {
+        if (!empty()) {
+            publishBuffer(allocateBuffer(0));
+        }
+    }
+
+    // Frees the retired buffers no pinned reader can hold anymore, called after every retirement
+    void reclaim() {
+        uint64_t oldestPinned = std::numeric_limits<uint64_t>::max();
+
+        for (const ReaderSlot &slot: m_readers) {
+            const uint64_t epoch = slot.epoch.load();
+
+            if (epoch != 0) {
+                oldestPinned = std::min(oldestPinned, epoch);
+            }
+        }
+
+        m_retired.erase_if([this, oldestPinned](const Retired &retired) {
+            if (retired.epoch >= oldestPinned) {
+                return false;
+            }
+
+            freeBuffer(retired.buffer);
+            return true;
+        });
+    }
+
+    size_t retired_count() const {
+        return m_retired.size();
+    }
+
+    // Writer view, readers use pin()
+    const T &operator[](size_t index) const {
+        return currentBuffer()->elems[index];
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    size_t size() const {
+        return currentBuffer()->size.load(std::memory_order_relaxed);
+    }
+
+    size_t capacity() const {
+        return currentBuffer()->capacity;
+    }
+};
+
+#endif //VECTOR_RCUVECTOR_H
@@ -0,0 +1,81 @@
+//
+// Created by Sebastian on 16.10.2026.
+//
+
+#ifndef VECTOR_SMALLVECTOR_H
+#define VECTOR_SMALLVECTOR_H
+
+#include "Vector.h"
+
+// Allocator with storage for N elements embedded in itself, larger requests spill to the heap.
+// Vector keeps the inline buffer with its owner on moves and swaps (see HasInlineBuffer)
+template<typename T, size_t N>
+class InlineBufferAllocator {
+private:
+    alignas(T) uint8_t m_buffer[N * sizeof(T)];
+    bool m_bufferInUse = false;
+    MallocAllocator<T> m_heapAlloc;
+
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::false_type;
+    using propagate_on_container_swap = std::false_type;
+    using is_always_equal = std::false_type;
+
+    template<typename U>
+    struct rebind {
+        using other = InlineBufferAllocator<U, N>;
+    };
+
+    // User provided so value initialization doesn't zero the buffer
+    InlineBufferAllocator() noexcept {}
+
+    // Copies get their own, unused buffer
+    InlineBufferAllocator(const InlineBufferAllocator &) noexcept {}
+
+    InlineBufferAllocator &operator=(const InlineBufferAllocator &) noexcept {
+        return *this;
+    }
+
+    AllocationResult<T *> allocate_at_least(size_t elemCount) {
+        if (!m_bufferInUse && elemCount <= N) {
+            m_bufferInUse = true;
+            return {(T *) m_buffer, N};
+        }
+
+        return {m_heapAlloc.allocate(elemCount), elemCount};
+    }
+
+    T *allocate(size_t elemCount) {
+        return allocate_at_least(elemCount).ptr;
+    }
+
+    void deallocate(T *ptr, size_t elemCount) noexcept {
+        if (isInlineBuffer(ptr)) {
+            m_bufferInUse = false;
+            return;
+        }
+
+        m_heapAlloc.deallocate(ptr, elemCount);
+    }
+
+    [[nodiscard]] bool isInlineBuffer(const T *ptr) const {
+        return ptr == (const T *) m_buffer;
+    }
+
+    // Heap memory can be freed by every instance, the inline buffer is never handed over by Vector
+    friend bool operator==(const InlineBufferAllocator &, const InlineBufferAllocator &) {
+        return true;
+    }
+
+    friend bool operator!=(const InlineBufferAllocator &, const InlineBufferAllocator &) {
+        return false;
+    }
+};
+
+// Vector keeping up to N elements inside the object, only spills to the heap after that
+template<typename T, size_t N, GrowthPolicy Growth = GrowthFactor<3, 2>>
+using SmallVector = Vector<T, InlineBufferAllocator<T, N>, Growth>;
+
+#endif //VECTOR_SMALLVECTOR_H
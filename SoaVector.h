@@ -0,0 +1,495 @@
+//
+// Created by Sebastian on 16.10.2026.
+//
+
+#ifndef VECTOR_SOAVECTOR_H
+#define VECTOR_SOAVECTOR_H
+
+#include "Vector.h"
+#include <tuple>
+
+// Row of references into the columns of a SoaVector. Behaves like the std::tuple it derives from, but being
+// its own type it can declare the common reference with the row values, which std::tuple only gets in C++23
+template<typename... Refs>
+struct SoaRow : std::tuple<Refs...> {
+    using std::tuple<Refs...>::tuple;
+    using std::tuple<Refs...>::operator=;
+
+    // Binds to the fields of a row value, std::tuple only converts non-const lvalues like this since C++23
+    template<typename... Values>
+    requires (sizeof...(Values) == sizeof...(Refs) && (std::is_convertible_v<Values &, Refs> && ...))
+    SoaRow(std::tuple<Values...> &values)
+            : std::tuple<Refs...>(std::apply([](auto &... fields) {
+        return std::tuple<Refs...>(fields...);
+    }, values)) {}
+};
+
+template<typename... Refs>
+struct std::tuple_size<SoaRow<Refs...>> : std::integral_constant<size_t, sizeof...(Refs)> {
+};
+
+template<size_t Index, typename... Refs>
+struct std::tuple_element<Index, SoaRow<Refs...>> : std::tuple_element<Index, std::tuple<Refs...>> {
+};
+
+template<typename... Refs, typename... Values, template<typename> class RefQual, template<typename> class ValueQual>
+requires (sizeof...(Refs) == sizeof...(Values))
+struct std::basic_common_reference<SoaRow<Refs...>, std::tuple<Values...>, RefQual, ValueQual> {
+    using type = SoaRow<std::common_reference_t<RefQual<Refs>, ValueQual<Values>>...>;
+};
+
+template<typename... Values, typename... Refs, template<typename> class ValueQual, template<typename> class RefQual>
+requires (sizeof...(Refs) == sizeof...(Values))
+struct std::basic_common_reference<std::tuple<Values...>, SoaRow<Refs...>, ValueQual, RefQual> {
+    using type = SoaRow<std::common_reference_t<ValueQual<Values>, RefQual<Refs>>...>;
+};
+
+// Structure of arrays, every field lives in its own contiguous column so loops touching a few fields
+// only load those. All columns share one buffer, size and capacity, grown like Vector through Growth
+template<GrowthPolicy Growth, typename... Ts>
+class BasicSoaVector {
+    static_assert(sizeof...(Ts) > 0, "SoaVector needs at least one column");
+    static_assert((std::is_nothrow_move_constructible_v<Ts> && ...),
+                  "Columns have to be nothrow move constructible, growth relocates them one after another");
+
+public:
+    using value_type = std::tuple<Ts...>;
+    using reference = SoaRow<Ts &...>;
+    using const_reference = SoaRow<const Ts &...>;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+
+    template<size_t Index>
+    using column_type = std::tuple_element_t<Index, value_type>;
+
+private:
+    using Columns = std::tuple<Ts *...>;
+    using ConstColumns = std::tuple<const Ts *...>;
+
+    // Columns start on their own cache line
+    static constexpr size_t ColumnAlignment = std::max({size_t{64}, alignof(Ts)...});
+    static constexpr size_t RowSize = (sizeof(Ts) + ...);
+
+    using BufferAlloc = MallocAllocator<uint8_t, ColumnAlignment>;
+
+    uint8_t *m_data{};
+    Columns m_columns{};
+    size_t m_capacity{};
+    size_t m_elemCount{};
+    [[no_unique_address]] BufferAlloc m_alloc{};
+
+    template<typename T>
+    static constexpr size_t columnBytes(size_t capacity) {
+        return (capacity * sizeof(T) + ColumnAlignment - 1) / ColumnAlignment * ColumnAlignment;
+    }
+
+    static constexpr size_t bufferBytes(size_t capacity) {
+        return (columnBytes<Ts>(capacity) + ...);
+    }
+
+    template<typename T>
+    static T *columnAt(uint8_t *buffer, size_t capacity, size_t &offset) {
+        T *column = (T *) (buffer + offset);
+        offset += columnBytes<T>(capacity);
+
+        return column;
+    }
+
+    static Columns columnsIn(uint8_t *buffer, size_t capacity) {
+        size_t offset = 0;
+        // Braced initializers are evaluated left to right
+        return Columns{columnAt<Ts>(buffer, capacity, offset)...};
+    }
+
+    // Calls func(column, otherColumns...) for every column index
+    template<typename Func, typename... OtherColumns>
+    static void forEachColumn(Func &&func, const Columns &columns, const OtherColumns &... others) {
+        const auto callFor = [&]<size_t Index>() {
+            func(std::get<Index>(columns), std::get<Index>(others)...);
+        };
+
+        [&]<size_t... Indices>(std::index_sequence<Indices...>) {
+            (callFor.template operator()<Indices>(), ...);
+        }(std::index_sequence_for<Ts...>{});
+    }
+
+    size_t nextCapacity(size_t requiredCapacity) const {
+        return Growth::nextCapacity(m_capacity, requiredCapacity, RowSize);
+    }
+
+    uint8_t *allocateBuffer(size_t capacity) {
+        if (capacity > max_size()) {
+            throw std::bad_array_new_length();
+        }
+
+        return m_alloc.allocate(bufferBytes(capacity));
+    }
+
+    void freeBuffer(uint8_t *buffer, size_t capacity) {
+        if (buffer) {
+            m_alloc.deallocate(buffer, bufferBytes(capacity));
+        }
+    }
+
+    void destructRows(size_t from, size_t to) {
+        forEachColumn([from, to](auto *column) {
+            std::destroy(column + from, column + to);
+        }, m_columns);
+    }
+
+    // Relocates all rows into the new buffer and releases the old one
+    void adoptBuffer(uint8_t *buffer, size_t capacity) {
+        const Columns columns = columnsIn(buffer, capacity);
+
+        forEachColumn([this](auto *column, auto *newColumn) {
+            using T = std::remove_pointer_t<decltype(column)>;
+
+            if constexpr (IsTriviallyRelocatable<T>::value) {
+                if (m_elemCount > 0) {
+                    std::memcpy((void *) newColumn, (const void *) column, m_elemCount * sizeof(T));
+                }
+            } else {
+                std::uninitialized_move_n(column, m_elemCount, newColumn);
+                std::destroy_n(column, m_elemCount);
+            }
+        }, m_columns, columns);
+
+        freeBuffer(m_data, m_capacity);
+        m_data = buffer;
+        m_columns = columns;
+        m_capacity = capacity;
+    }
+
+    // Every field constructed or none, earlier fields are destroyed if a later one throws
+    template<size_t Index, typename Arg, typename... Rest>
+    static void constructRow(const Columns &columns, size_t row, Arg &&arg, Rest &&... rest) {
+        using T = column_type<Index>;
+        T *elem = std::get<Index>(columns) + row;
+        new(elem)T(std::forward<Arg>(arg));
+
+        if constexpr (sizeof...(Rest) > 0) {
+            try {
+                constructRow<Index + 1>(columns, row, std::forward<Rest>(rest)...);
+            } catch (...) {
+                elem->~T();
+                throw;
+            }
+        }
+    }
+
+    void copyRowsFrom(const BasicSoaVector &other) {
+        size_t copiedColumns = 0;
+
+        try {
+            forEachColumn([&other, &copiedColumns](auto *column, auto *otherColumn) {
+                std::uninitialized_copy_n(otherColumn, other.m_elemCount, column);
+                copiedColumns++;
+            }, m_columns, other.m_columns);
+        } catch (...) {
+            size_t column = 0;
+
+            forEachColumn([&other, &column, copiedColumns](auto *copied) {
+                if (column++ < copiedColumns) {
+                    std::destroy_n(copied, other.m_elemCount);
+                }
+            }, m_columns);
+
+            throw;
+        }
+    }
+
+public:
+    // Iterates rows, dereferencing yields a SoaRow of references into the columns
+    template<bool IsConst>
+    class Iterator {
+        friend class BasicSoaVector;
+
+        template<bool>
+        friend class Iterator;
+
+        using IterColumns = std::conditional_t<IsConst, ConstColumns, Columns>;
+
+        IterColumns m_columns{};
+        size_t m_index{};
+
+        Iterator(IterColumns columns, size_t index) : m_columns{columns}, m_index{index} {}
+
+    public:
+        // Proxy references only meet the C++20 iterator requirements, like std::ranges::zip_view
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = BasicSoaVector::value_type;
+        using reference = std::conditional_t<IsConst, BasicSoaVector::const_reference, BasicSoaVector::reference>;
+        using pointer = void;
+
+        Iterator() = default;
+
+        operator Iterator<true>() const requires (!IsConst) {
+            return Iterator<true>{m_columns, m_index};
+        }
+
+        reference operator*() const {
+            return std::apply([this](auto *... columns) {
+                return reference{columns[m_index]...};
+            }, m_columns);
+        }
+
+        reference operator[](difference_type offset) const {
+            return *(*this + offset);
+        }
+
+        Iterator &operator++() {
+            m_index++;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator temp = *this;
+            m_index++;
+            return temp;
+        }
+
+        Iterator &operator--() {
+            m_index--;
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            Iterator temp = *this;
+            m_index--;
+            return temp;
+        }
+
+        Iterator &operator+=(difference_type offset) {
+            m_index += offset;
+            return *this;
+        }
+
+        Iterator &operator-=(difference_type offset) {
+            m_index -= offset;
+            return *this;
+        }
+
+        friend Iterator operator+(Iterator iter, difference_type offset) {
+            return iter += offset;
+        }
+
+        friend Iterator operator+(difference_type offset, Iterator iter) {
+            return iter += offset;
+        }
+
+        friend Iterator operator-(Iterator iter, difference_type offset) {
+            return iter -= offset;
+        }
+
+        friend difference_type operator-(const Iterator &lhs, const Iterator &rhs) {
+            return (difference_type) lhs.m_index - (difference_type) rhs.m_index;
+        }
+
+        bool operator==(const Iterator &rhs) const {
+            return m_index == rhs.m_index;
+        }
+
+        auto operator<=>(const Iterator &rhs) const {
+            return m_index <=> rhs.m_index;
+        }
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    BasicSoaVector() = default;
+
+    explicit BasicSoaVector(size_t capacity) {
+        reserve(capacity);
+    }
+
+    BasicSoaVector(const BasicSoaVector &other) {
+        if (other.m_elemCount == 0) {
+            return;
+        }
+
+        uint8_t *buffer = allocateBuffer(other.m_elemCount);
+        m_data = buffer;
+        m_columns = columnsIn(buffer, other.m_elemCount);
+        m_capacity = other.m_elemCount;
+
+        try {
+            copyRowsFrom(other);
+        } catch (...) {
+            freeBuffer(m_data, m_capacity);
+            throw;
+        }
+
+        m_elemCount = other.m_elemCount;
+    }
+
+    BasicSoaVector(BasicSoaVector &&other) noexcept {
+        swap(other);
+    }
+
+    BasicSoaVector &operator=(const BasicSoaVector &other) {
+        if (this != &other) {
+            BasicSoaVector copy = other;
+            swap(copy);
+        }
+
+        return *this;
+    }
+
+    BasicSoaVector &operator=(BasicSoaVector &&other) noexcept {
+        BasicSoaVector moved = std::move(other);
+        swap(moved);
+
+        return *this;
+    }
+
+    ~BasicSoaVector() {
+        destructRows(0, m_elemCount);
+        freeBuffer(m_data, m_capacity);
+    }
+
+    void swap(BasicSoaVector &other) noexcept {
+        std::swap(m_data, other.m_data);
+        std::swap(m_columns, other.m_columns);
+        std::swap(m_capacity, other.m_capacity);
+        std::swap(m_elemCount, other.m_elemCount);
+    }
+
+    friend void swap(BasicSoaVector &lhs, BasicSoaVector &rhs) noexcept {
+        lhs.swap(rhs);
+    }
+
+    // Modifiers, one argument per column
+    template<typename... Args>
+    requires (sizeof...(Args) == sizeof...(Ts))
+    reference emplace_back(Args &&... args) {
+        if (m_elemCount == m_capacity) {
+            // The new row is built before the old buffer goes away, arguments may refer to our own rows
+            const size_t newCapacity = nextCapacity(m_elemCount + 1);
+            uint8_t *buffer = allocateBuffer(newCapacity);
+
+            try {
+                constructRow<0>(columnsIn(buffer, newCapacity), m_elemCount, std::forward<Args>(args)...);
+            } catch (...) {
+                freeBuffer(buffer, newCapacity);
+                throw;
+            }
+
+            adoptBuffer(buffer, newCapacity);
+        } else {
+            constructRow<0>(m_columns, m_elemCount, std::forward<Args>(args)...);
+        }
+
+        m_elemCount++;
+        return (*this)[m_elemCount - 1];
+    }
+
+    void push_back(const Ts &... values) {
+        emplace_back(values...);
+    }
+
+    void pop_back() {
+        if (m_elemCount == 0) {
+            return;
+        }
+
+        destructRows(m_elemCount - 1, m_elemCount);
+        m_elemCount--;
+    }
+
+    void clear() {
+        destructRows(0, m_elemCount);
+        m_elemCount = 0;
+    }
+
+    // Capacity
+    bool empty() const {
+        return m_elemCount == 0;
+    }
+
+    size_t size() const {
+        return m_elemCount;
+    }
+
+    size_t capacity() const {
+        return m_capacity;
+    }
+
+    static constexpr size_t max_size() {
+        return (std::numeric_limits<std::ptrdiff_t>::max() - ColumnAlignment * sizeof...(Ts)) / RowSize;
+    }
+
+    void reserve(size_t capacity) {
+        if (capacity > m_capacity) {
+            adoptBuffer(allocateBuffer(capacity), capacity);
+        }
+    }
+
+    // Element access
+    reference operator[](size_t index) {
+        return begin()[index];
+    }
+
+    const_reference operator[](size_t index) const {
+        return begin()[index];
+    }
+
+    reference at(size_t index) {
+        if (index >= m_elemCount) {
+            throw std::out_of_range("Out of range");
+        }
+
+        return (*this)[index];
+    }
+
+    const_reference at(size_t index) const {
+        if (index >= m_elemCount) {
+            throw std::out_of_range("Out of range");
+        }
+
+        return (*this)[index];
+    }
+
+    // Contiguous view of one field over all rows
+    template<size_t Index>
+    std::span<column_type<Index>> column() {
+        return {std::get<Index>(m_columns), m_elemCount};
+    }
+
+    template<size_t Index>
+    std::span<const column_type<Index>> column() const {
+        return {std::get<Index>(m_columns), m_elemCount};
+    }
+
+    // Iterators
+    iterator begin() {
+        return {m_columns, 0};
+    }
+
+    iterator end() {
+        return {m_columns, m_elemCount};
+    }
+
+    const_iterator begin() const {
+        return {ConstColumns{m_columns}, 0};
+    }
+
+    const_iterator end() const {
+        return {ConstColumns{m_columns}, m_elemCount};
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+};
+
+template<typename... Ts>
+using SoaVector = BasicSoaVector<GrowthFactor<3, 2>, Ts...>;
+
+#endif //VECTOR_SOAVECTOR_H
@@ -0,0 +1,449 @@
+//
+// Created by Sebastian on 16.10.2026.
+//
+
+#ifndef VECTOR_STABLEVECTOR_H
+#define VECTOR_STABLEVECTOR_H
+
+#include "Vector.h"
+#include <array>
+
+// Segmented vector which never relocates its elements, pointers and references stay valid until the element
+// is removed. Block b holds FirstBlockSize << b elements, so the block of an index is found with a bit scan
+template<typename T, size_t FirstBlockSize = 16, typename Alloc = MallocAllocator<T>>
+class StableVector {
+    static_assert(FirstBlockSize > 0 && (FirstBlockSize & (FirstBlockSize - 1)) == 0,
+                  "First block size has to be a power of two");
+
+    using AllocTraits = std::allocator_traits<Alloc>;
+
+    static_assert(std::is_same_v<typename AllocTraits::value_type, T>, "Allocator value_type has to match T");
+
+    static constexpr size_t FirstBlockShift = std::countr_zero(FirstBlockSize);
+    // Enough blocks to address every index
+    static constexpr size_t MaxBlocks = std::numeric_limits<size_t>::digits - FirstBlockShift;
+
+    std::array<T *, MaxBlocks> m_blocks{};
+    size_t m_blockCount{};
+    size_t m_capacity{};
+    size_t m_elemCount{};
+    [[no_unique_address]] Alloc m_alloc{};
+
+    static constexpr size_t blockSize(size_t block) {
+        return FirstBlockSize << block;
+    }
+
+    // Index i lives in the block of the highest set bit of i + FirstBlockSize
+    static size_t blockOf(size_t index) {
+        return std::bit_width(index + FirstBlockSize) - 1 - FirstBlockShift;
+    }
+
+    static size_t offsetInBlock(size_t index, size_t block) {
+        return index + FirstBlockSize - blockSize(block);
+    }
+
+    T *elemPtr(size_t index) const {
+        const size_t block = blockOf(index);
+        return m_blocks[block] + offsetInBlock(index, block);
+    }
+
+    void addBlock() {
+        if (m_blockCount == MaxBlocks || m_capacity > max_size() - blockSize(m_blockCount)) {
+            throw std::bad_array_new_length();
+        }
+
+        m_blocks[m_blockCount] = AllocTraits::allocate(m_alloc, blockSize(m_blockCount));
+        m_capacity += blockSize(m_blockCount);
+        m_blockCount++;
+    }
+
+    void freeBlocksFrom(size_t firstBlock) {
+        while (m_blockCount > firstBlock) {
+            m_blockCount--;
+            m_capacity -= blockSize(m_blockCount);
+            AllocTraits::deallocate(m_alloc, m_blocks[m_blockCount], blockSize(m_blockCount));
+            m_blocks[m_blockCount] = nullptr;
+        }
+    }
+
+    void destructElems(size_t from, size_t to) {
+        for (size_t i = from; i < to; i++) {
+            elemPtr(i)->~T();
+        }
+    }
+
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = const T &;
+
+    // Random access through the block table, elements are not contiguous across blocks
+    template<bool IsConst>
+    class Iterator {
+        friend class StableVector;
+
+        template<bool>
+        friend class Iterator;
+
+        using Owner = std::conditional_t<IsConst, const StableVector, StableVector>;
+
+        Owner *m_owner{};
+        size_t m_index{};
+
+        Iterator(Owner *owner, size_t index) : m_owner{owner}, m_index{index} {}
+
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = T;
+        using pointer = std::conditional_t<IsConst, const T *, T *>;
+        using reference = std::conditional_t<IsConst, const T &, T &>;
+
+        Iterator() = default;
+
+        operator Iterator<true>() const requires (!IsConst) {
+            return Iterator<true>{m_owner, m_index};
+        }
+
+        reference operator*() const {
+            return *m_owner->elemPtr(m_index);
+        }
+
+        pointer operator->() const {
+            return m_owner->elemPtr(m_index);
+        }
+
+        reference operator[](difference_type offset) const {
+            return *m_owner->elemPtr(m_index + offset);
+        }
+
+        Iterator &operator++() {
+            m_index++;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator temp = *this;
+            m_index++;
+            return temp;
+        }
+
+        Iterator &operator--() {
+            m_index--;
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            Iterator temp = *this;
+            m_index--;
+            return temp;
+        }
+
+        Iterator &operator+=(difference_type offset) {
+            m_index += offset;
+            return *this;
+        }
+
+        Iterator &operator-=(difference_type offset) {
+            m_index -= offset;
+            return *this;
+        }
+
+        friend Iterator operator+(Iterator iter, difference_type offset) {
+            return iter += offset;
+        }
+
+        friend Iterator operator+(difference_type offset, Iterator iter) {
+            return iter += offset;
+        }
+
+        friend Iterator operator-(Iterator iter, difference_type offset) {
+            return iter -= offset;
+        }
+
+        friend difference_type operator-(const Iterator &lhs, const Iterator &rhs) {
+            return (difference_type) lhs.m_index - (difference_type) rhs.m_index;
+        }
+
+        bool operator==(const Iterator &rhs) const {
+            return m_index == rhs.m_index;
+        }
+
+        auto operator<=>(const Iterator &rhs) const {
+            return m_index <=> rhs.m_index;
+        }
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    StableVector() = default;
+
+    explicit StableVector(const Alloc &alloc) : m_alloc{alloc} {}
+
+    StableVector(std::initializer_list<T> values) {
+        reserve(values.size());
+
+        for (const T &value: values) {
+            push_back(value);
+        }
+    }
+
+    StableVector(const StableVector &other)
+            : m_alloc{AllocTraits::select_on_container_copy_construction(other.m_alloc)} {
+        reserve(other.m_elemCount);
+
+        try {
+            for (const T &value: other) {
+                push_back(value);
+            }
+        } catch (...) {
+            clear();
+            freeBlocksFrom(0);
+            throw;
+        }
+    }
+
+    // Blocks are handed over, the elements keep their addresses
+    StableVector(StableVector &&other) noexcept : m_alloc{std::move(other.m_alloc)} {
+        swapStorage(other);
+    }
+
+    StableVector &operator=(const StableVector &other) {
+        if (this == &other) {
+            return *this;
+        }
+
+        clear();
+
+        if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+            // Blocks have to be given back to the allocator they came from
+            if (m_alloc != other.m_alloc) {
+                freeBlocksFrom(0);
+            }
+
+            m_alloc = other.m_alloc;
+        }
+
+        reserve(other.m_elemCount);
+
+        for (const T &value: other) {
+            push_back(value);
+        }
+
+        return *this;
+    }
+
+    StableVector &operator=(StableVector &&other) noexcept(AllocTraits::propagate_on_container_move_assignment::value ||
+                                                          AllocTraits::is_always_equal::value) {
+        if (this == &other) {
+            return *this;
+        }
+
+        clear();
+
+        if constexpr (!AllocTraits::propagate_on_container_move_assignment::value &&
+                      !AllocTraits::is_always_equal::value) {
+            // Our allocator can't free the blocks of other, the elements get moved one by one
+            if (m_alloc != other.m_alloc) {
+                reserve(other.m_elemCount);
+
+                for (T &value: other) {
+                    emplace_back(std::move(value));
+                }
+
+                other.clear();
+                return *this;
+            }
+        }
+
+        freeBlocksFrom(0);
+
+        if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+            m_alloc = std::move(other.m_alloc);
+        }
+
+        swapStorage(other);
+        return *this;
+    }
+
+    ~StableVector() {
+        clear();
+        freeBlocksFrom(0);
+    }
+
+    // Without propagation both allocators have to compare equal, like for the std containers
+    void swap(StableVector &other) noexcept {
+        if constexpr (AllocTraits::propagate_on_container_swap::value) {
+            using std::swap;
+            swap(m_alloc, other.m_alloc);
+        }
+
+        swapStorage(other);
+    }
+
+    friend void swap(StableVector &lhs, StableVector &rhs) noexcept {
+        lhs.swap(rhs);
+    }
+
+    Alloc get_allocator() const {
+        return m_alloc;
+    }
+
+    // Modifiers, existing elements are never moved so arguments referring to them stay valid
+    template<typename... Args>
+    T &emplace_back(Args &&... args) {
+        if (m_elemCount == m_capacity) {
+            addBlock();
+        }
+
+        T *elem = elemPtr(m_elemCount);
+        new(elem)T(std::forward<Args>(args)...);
+        m_elemCount++;
+
+        return *elem;
+    }
+
+    void push_back(const T &value) {
+        emplace_back(value);
+    }
+
+    void push_back(T &&value) {
+        emplace_back(std::move(value));
+    }
+
+    void pop_back() {
+        if (m_elemCount == 0) {
+            return;
+        }
+
+        m_elemCount--;
+        elemPtr(m_elemCount)->~T();
+    }
+
+    // Blocks are kept for reuse, shrink_to_fit releases them
+    void clear() {
+        destructElems(0, m_elemCount);
+        m_elemCount = 0;
+    }
+
+    // Element access
+    T &at(size_t index) {
+        if (index >= m_elemCount) {
+            throw std::out_of_range("Out of range");
+        }
+
+        return *elemPtr(index);
+    }
+
+    const T &at(size_t index) const {
+        if (index >= m_elemCount) {
+            throw std::out_of_range("Out of range");
+        }
+
+        return *elemPtr(index);
+    }
+
+    T &operator[](size_t index) {
+        return *elemPtr(index);
+    }
+
+    const T &operator[](size_t index) const {
+        return *elemPtr(index);
+    }
+
+    T &front() {
+        return at(0);
+    }
+
+    const T &front() const {
+        return at(0);
+    }
+
+    T &back() {
+        if (m_elemCount == 0) {
+            throw std::out_of_range("Container is empty");
+        }
+
+        return *elemPtr(m_elemCount - 1);
+    }
+
+    const T &back() const {
+        if (m_elemCount == 0) {
+            throw std::out_of_range("Container is empty");
+        }
+
+        return *elemPtr(m_elemCount - 1);
+    }
+
+    // Capacity
+    bool empty() const {
+        return m_elemCount == 0;
+    }
+
+    size_t size() const {
+        return m_elemCount;
+    }
+
+    size_t max_size() const {
+        return std::min<size_t>(AllocTraits::max_size(m_alloc), std::numeric_limits<std::ptrdiff_t>::max() / sizeof(T));
+    }
+
+    size_t capacity() const {
+        return m_capacity;
+    }
+
+    size_t block_count() const {
+        return m_blockCount;
+    }
+
+    void reserve(size_t capacity) {
+        while (m_capacity < capacity) {
+            addBlock();
+        }
+    }
+
+    // Frees the blocks behind the last element
+    void shrink_to_fit() {
+        freeBlocksFrom(m_elemCount == 0 ? 0 : blockOf(m_elemCount - 1) + 1);
+    }
+
+    // Iterators
+    iterator begin() {
+        return {this, 0};
+    }
+
+    iterator end() {
+        return {this, m_elemCount};
+    }
+
+    const_iterator begin() const {
+        return {this, 0};
+    }
+
+    const_iterator end() const {
+        return {this, m_elemCount};
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+
+private:
+    void swapStorage(StableVector &other) noexcept {
+        std::swap(m_blocks, other.m_blocks);
+        std::swap(m_blockCount, other.m_blockCount);
+        std::swap(m_capacity, other.m_capacity);
+        std::swap(m_elemCount, other.m_elemCount);
+    }
+};
+
+#endif //VECTOR_STABLEVECTOR_H
@@ -6,53 +6,384 @@
 #define VECTOR_VECTOR_H
 
 #include <cstddef>
+#include <algorithm>
+#include <functional>
 #include <stdexcept>
 #include <limits>
 #include <cstdint>
 #include <cassert>
 #include <cstdarg>
+#include <cstring>
+#include <cstdlib>
+#include <bit>
+#include <concepts>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <memory>
+#include <memory_resource>
+#include <utility>
 #include <span>
 
+// Types for which moving an object to a new address and ending the lifetime of the old one
+// is equivalent to copying its bytes. Can be specialized for types that are relocatable
+// but not trivially copyable.
 template<typename T>
+struct IsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T> ||
+                                                   (std::is_trivially_move_constructible_v<T> &&
+                                                    std::is_trivially_destructible_v<T>)> {
+};
+
+// Default allocator of Vector, malloc based so relocatable buffers can be grown with realloc.
+// Buffers are aligned to at least Alignment and alignof(T), over-aligned ones come from aligned_alloc
+template<typename T, size_t Alignment = alignof(T)>
+struct MallocAllocator {
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment has to be a power of two");
+
+    using value_type = T;
+
+    static constexpr size_t alignment = std::max(Alignment, alignof(T));
+
+    template<typename U>
+    struct rebind {
+        using other = MallocAllocator<U, Alignment>;
+    };
+
+    MallocAllocator() = default;
+
+    template<typename U>
+    MallocAllocator(const MallocAllocator<U, Alignment> &) noexcept {}
+
+    T *allocate(size_t elemCount) {
+        if (elemCount > std::numeric_limits<size_t>::max() / 2 / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+
+        void *mem;
+
+        if constexpr (alignment <= alignof(std::max_align_t)) {
+            mem = malloc(elemCount * sizeof(T));
+        } else {
+            // aligned_alloc wants a multiple of the alignment as size
+            const size_t bytes = (elemCount * sizeof(T) + alignment - 1) / alignment * alignment;
+            mem = std::aligned_alloc(alignment, bytes);
+        }
+
+        if (mem == nullptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T *>(mem);
+    }
+
+    void deallocate(T *ptr, size_t) noexcept {
+        free(ptr);
+    }
+
+    // Extension used by Vector for trivially relocatable types, the contents get moved bytewise.
+    // Large blocks get remapped by glibc (mremap) instead of copied
+    T *reallocate(T *ptr, size_t elemCount, size_t newElemCount) {
+        if (newElemCount > std::numeric_limits<size_t>::max() / 2 / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+
+        // realloc only keeps the alignment of malloc
+        if constexpr (alignment > alignof(std::max_align_t)) {
+            T *mem = allocate(newElemCount);
+            std::memcpy(mem, ptr, std::min(elemCount, newElemCount) * sizeof(T));
+            deallocate(ptr, elemCount);
+            return mem;
+        }
+
+        void *mem = realloc(ptr, newElemCount * sizeof(T));
+
+        if (mem == nullptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T *>(mem);
+    }
+
+    friend bool operator==(const MallocAllocator &, const MallocAllocator &) {
+        return true;
+    }
+
+    friend bool operator!=(const MallocAllocator &, const MallocAllocator &) {
+        return false;
+    }
+};
+
+// Mirrors std::allocation_result, returned by the allocate_at_least allocator extension
+template<typename Pointer>
+struct AllocationResult {
+    Pointer ptr;
+    size_t count;
+};
+
+// Detects the allocate_at_least(count) allocator extension, allocators can hand out more elements than requested
+template<typename Alloc, typename = void>
+struct HasAllocateAtLeast : std::false_type {
+};
+
+template<typename Alloc>
+struct HasAllocateAtLeast<Alloc, std::void_t<decltype(std::declval<Alloc &>().allocate_at_least(size_t{}))>>
+        : std::true_type {
+};
+
+// Detects allocators which can hand out storage embedded in the allocator object itself (isInlineBuffer(ptr)).
+// Such buffers never change owner, they get moved element-wise instead
+template<typename Alloc, typename = void>
+struct HasInlineBuffer : std::false_type {
+};
+
+template<typename Alloc>
+struct HasInlineBuffer<Alloc, std::void_t<decltype(std::declval<const Alloc &>().isInlineBuffer(
+        std::declval<const typename Alloc::value_type *>()))>> : std::true_type {
+};
+
+// Detects the resizeInPlace(ptr, oldCount, newCount) allocator extension. It grows or shrinks a buffer
+// without moving it and returns the new capacity, 0 when the buffer would have to move
+template<typename Alloc, typename = void>
+struct HasResizeInPlace : std::false_type {
+};
+
+template<typename Alloc>
+struct HasResizeInPlace<Alloc, std::void_t<decltype(std::declval<Alloc &>().resizeInPlace(
+        std::declval<typename std::allocator_traits<Alloc>::pointer>(), size_t{}, size_t{}))>> : std::true_type {
+};
+
+// Detects the non-standard reallocate(ptr, oldCount, newCount) allocator extension
+template<typename Alloc, typename = void>
+struct HasReallocate : std::false_type {
+};
+
+template<typename Alloc>
+struct HasReallocate<Alloc, std::void_t<decltype(std::declval<Alloc &>().reallocate(
+        std::declval<typename std::allocator_traits<Alloc>::pointer>(), size_t{}, size_t{}))>> : std::true_type {
+};
+
+// Growth policies compute the capacity of the next buffer from the current capacity,
+// the required capacity and the element size. The result has to be at least requiredCapacity
+template<typename Policy>
+concept GrowthPolicy = requires(size_t capacity, size_t requiredCapacity, size_t elemSize) {
+    { Policy::nextCapacity(capacity, requiredCapacity, elemSize) } -> std::same_as<size_t>;
+};
+
+// Multiplies the capacity with Numerator / Denominator
+template<size_t Numerator, size_t Denominator = 1>
+struct GrowthFactor {
+    static_assert(Denominator > 0 && Numerator > Denominator, "Growth factor has to be greater than 1");
+
+    static constexpr size_t nextCapacity(size_t capacity, size_t requiredCapacity, size_t) {
+        // Divide first so large capacities don't overflow
+        const size_t grown = capacity / Denominator * Numerator + capacity % Denominator * Numerator / Denominator;
+        return std::max(grown, requiredCapacity);
+    }
+};
+
+// Adds Step elements on every growth, for append logs which should not over-allocate
+template<size_t Step>
+struct FixedStepGrowth {
+    static_assert(Step > 0, "Step has to be greater than 0");
+
+    static constexpr size_t nextCapacity(size_t capacity, size_t requiredCapacity, size_t) {
+        return std::max(capacity + Step, requiredCapacity);
+    }
+};
+
+// Grows with Base and rounds the buffer up to the next malloc size class, four classes per power of two
+// like the bins of jemalloc and tcmalloc. The rounding space would be wasted by the allocator otherwise
+template<GrowthPolicy Base = GrowthFactor<3, 2>>
+struct SizeClassGrowth {
+    static constexpr size_t minClassSize = 16;
+
+    static constexpr size_t roundToSizeClass(size_t bytes) {
+        if (bytes <= minClassSize) {
+            return minClassSize;
+        }
+
+        const size_t classSpacing = (size_t{1} << (std::bit_width(bytes - 1) - 1)) / 4;
+        return (bytes + classSpacing - 1) / classSpacing * classSpacing;
+    }
+
+    static constexpr size_t nextCapacity(size_t capacity, size_t requiredCapacity, size_t elemSize) {
+        const size_t baseCapacity = Base::nextCapacity(capacity, requiredCapacity, elemSize);
+
+        if (baseCapacity > std::numeric_limits<size_t>::max() / 2 / elemSize) {
+            return baseCapacity;
+        }
+
+        return roundToSizeClass(baseCapacity * elemSize) / elemSize;
+    }
+};
+
+// Statistics hooks, called by Vector whenever its buffer changes. See VectorStats.h for a recording implementation
+template<typename Policy>
+concept StatsPolicy = std::default_initializable<Policy> && requires(Policy stats, size_t value) {
+    stats.onAllocation(value);
+    stats.onDeallocation(value);
+    stats.onRelocation(value);
+    stats.onElemsMoved(value);
+    stats.onCapacity(value);
+};
+
+// Default statistics policy, the empty hooks compile to nothing
+struct NoVectorStats {
+    void onAllocation(size_t) {}
+
+    void onDeallocation(size_t) {}
+
+    void onRelocation(size_t) {}
+
+    void onElemsMoved(size_t) {}
+
+    void onCapacity(size_t) {}
+};
+
+template<typename T, typename Alloc = MallocAllocator<T>, GrowthPolicy Growth = GrowthFactor<3, 2>,
+        StatsPolicy Stats = NoVectorStats>
 class Vector {
 private:
-    inline static const double growthFactor = 1.5;
+    using AllocTraits = std::allocator_traits<Alloc>;
+
+    static_assert(std::is_same_v<typename AllocTraits::value_type, T>, "Allocator value_type has to match T");
+    static_assert(std::is_pointer_v<typename AllocTraits::pointer>, "Fancy pointers are not supported");
+
     uint8_t *m_data{};
     size_t m_capacity{};
     size_t m_elemCount{};
+    [[no_unique_address]] Alloc m_alloc{};
+    // Not copied or moved along with the elements, every instance counts its own activity
+    [[no_unique_address]] Stats m_stats{};
 
-    void *allocMany(size_t elemCount, size_t elemSize) {
-        void *mem = malloc(elemCount * elemSize);
+    AllocationResult<T *> allocMany(size_t elemCount) {
+        if (elemCount == 0) {
+            return {nullptr, 0};
+        }
 
-        if (mem == nullptr) {
-            throw std::bad_alloc();
+        AllocationResult<T *> result;
+
+        if constexpr (HasAllocateAtLeast<Alloc>::value) {
+            result = m_alloc.allocate_at_least(elemCount);
+        } else {
+            result = {AllocTraits::allocate(m_alloc, elemCount), elemCount};
         }
-        return mem;
+
+        m_stats.onAllocation(result.count * sizeof(T));
+        m_stats.onCapacity(result.count * sizeof(T));
+
+        return result;
     }
 
-    void growBuffer(size_t elemCount) {
-        const size_t nextCapacity = m_capacity * growthFactor;
-        const size_t actualNewCapacity = std::max(nextCapacity, m_elemCount + elemCount);
+    [[nodiscard]] bool isInlineBuffer() const {
+        if constexpr (HasInlineBuffer<Alloc>::value) {
+            return m_alloc.isInlineBuffer((const T *) m_data);
+        } else {
+            return false;
+        }
+    }
+
+    void freeBuffer(uint8_t *buffer, size_t capacity) {
+        if (buffer == nullptr) {
+            return;
+        }
+
+        m_stats.onDeallocation(capacity * sizeof(T));
+        AllocTraits::deallocate(m_alloc, (T *) buffer, capacity);
+    }
+
+    // A new buffer replaces the old one, the elements got carried over
+    void recordRelocation() {
+        if (m_data != nullptr) {
+            m_stats.onRelocation(m_elemCount * sizeof(T));
+        }
+    }
 
-        allocateBuffer(actualNewCapacity);
+    // Destructs all elements and gives the memory back to the allocator
+    void releaseBuffer() {
+        destructElems(0, m_elemCount);
+        freeBuffer(m_data, m_capacity);
+
+        m_data = nullptr;
+        m_elemCount = 0;
+        m_capacity = 0;
+    }
+
+    [[nodiscard]] size_t nextCapacity(size_t requiredCapacity) const {
+        return Growth::nextCapacity(m_capacity, requiredCapacity, sizeof(T));
+    }
+
+    void growBuffer(size_t elemCount) {
+        allocateBuffer(nextCapacity(m_elemCount + elemCount));
     }
 
     void allocateBuffer(size_t bufferSize) {
-        auto *tmpBuffer = static_cast<uint8_t *>(allocMany(bufferSize, sizeof(T)));
+        if (resizeBufferInPlace(bufferSize)) {
+            return;
+        }
 
-        if (tmpBuffer == nullptr) {
-            throw std::bad_alloc();
+        if constexpr (IsTriviallyRelocatable<T>::value && HasReallocate<Alloc>::value) {
+            reallocateBuffer(bufferSize);
+            return;
         }
 
-        for (size_t i = 0; i < m_elemCount; i++) {
-            const size_t elemOffset = i * sizeof(T);
-            auto *obj = (T *) &m_data[elemOffset];
-            new(tmpBuffer + elemOffset)T(std::move(*obj));
-            obj->~T();
+        auto [tmpBuffer, actualCapacity] = allocMany(bufferSize);
+
+        moveElemsToOtherBuffer(tmpBuffer, (T *) m_data, (T *) m_data + m_elemCount);
+
+        recordRelocation();
+        freeBuffer(m_data, m_capacity);
+        m_data = (uint8_t *) tmpBuffer;
+        m_capacity = actualCapacity;
+    }
+
+    // Elements stay where they are, so no pointer or iterator gets invalidated
+    bool resizeBufferInPlace(size_t bufferSize) {
+        if constexpr (HasResizeInPlace<Alloc>::value) {
+            if (m_data == nullptr || bufferSize == 0) {
+                return false;
+            }
+
+            const size_t actualCapacity = m_alloc.resizeInPlace((T *) m_data, m_capacity, bufferSize);
+
+            if (actualCapacity == 0) {
+                return false;
+            }
+
+            m_capacity = actualCapacity;
+            m_stats.onCapacity(actualCapacity * sizeof(T));
+            return true;
+        } else {
+            return false;
+        }
+    }
+
+    // Lets the allocator extend the block in place instead of allocating a new one and copying
+    void reallocateBuffer(size_t bufferSize) {
+        if (bufferSize == 0) {
+            freeBuffer(m_data, m_capacity);
+            m_data = nullptr;
+            m_capacity = 0;
+            return;
+        }
+
+        if (m_data == nullptr) {
+            auto [buffer, actualCapacity] = allocMany(bufferSize);
+            m_data = (uint8_t *) buffer;
+            m_capacity = actualCapacity;
+            return;
+        }
+
+        auto *buffer = (uint8_t *) m_alloc.reallocate((T *) m_data, m_capacity, bufferSize);
+
+        // Block got moved instead of resized
+        if (buffer != m_data) {
+            recordRelocation();
         }
 
-        free(m_data);
-        m_data = tmpBuffer;
+        m_stats.onDeallocation(m_capacity * sizeof(T));
+        m_stats.onAllocation(bufferSize * sizeof(T));
+        m_stats.onCapacity(bufferSize * sizeof(T));
+
+        m_data = buffer;
         m_capacity = bufferSize;
     }
 
@@ -90,6 +421,14 @@ private:
     }
 
     void shiftElemsRight(size_t from, size_t amount) {
+        m_stats.onElemsMoved(m_elemCount - from);
+
+        if constexpr (IsTriviallyRelocatable<T>::value) {
+            T *startPtr = &((T *) m_data)[from];
+            std::memmove(startPtr + amount, startPtr, (m_elemCount - from) * sizeof(T));
+            return;
+        }
+
         const T *startPtr = &((T *) m_data)[from];
         T *endPtr = &((T *) m_data)[m_elemCount - 1];
 
@@ -101,15 +440,61 @@ private:
     }
 
     void moveElemsToOtherBuffer(T *destBuffer, T *srcBufferFrom, T *srcBufferTo) {
+        m_stats.onElemsMoved(srcBufferTo - srcBufferFrom);
+
+        if constexpr (IsTriviallyRelocatable<T>::value) {
+            // Bulk copy, memcpy must not be called with null pointers
+            if (srcBufferFrom != srcBufferTo) {
+                std::memcpy(destBuffer, srcBufferFrom, (srcBufferTo - srcBufferFrom) * sizeof(T));
+            }
+            return;
+        }
+
         for (T *elem = srcBufferFrom; elem != srcBufferTo; elem++) {
             new(destBuffer++)T(std::move(*elem));
             elem->~T();
         }
     }
 
+    // Copy constructs the range into uninitialized memory, already constructed copies get destroyed on failure
+    void copyElemsToOtherBuffer(T *destBuffer, const T *srcBufferFrom, const T *srcBufferTo) {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (srcBufferFrom != srcBufferTo) {
+                std::memcpy(destBuffer, srcBufferFrom, (srcBufferTo - srcBufferFrom) * sizeof(T));
+            }
+            return;
+        }
+
+        T *dest = destBuffer;
+
+        try {
+            for (const T *elem = srcBufferFrom; elem != srcBufferTo; elem++) {
+                new(dest)T(*elem);
+                dest++;
+            }
+        } catch (...) {
+            for (T *elem = destBuffer; elem != dest; elem++) {
+                elem->~T();
+            }
+            throw;
+        }
+    }
+
+    bool ownsElem(const T *elem) const {
+        return std::less_equal<const T *>{}((const T *) m_data, elem) &&
+               std::less<const T *>{}(elem, (const T *) m_data + m_elemCount);
+    }
+
     T *insertAt(size_t pos, const T &elem, size_t count = 1) {
+        // Shifting or reallocating moves our own elements, a value referring to one of them gets copied first
+        if (ownsElem(&elem)) {
+            const T copy(elem);
+            return insertAt(pos, copy, count);
+        }
+
         // Get pointer to position in memory chunk, allocate new memory if required
-        const bool allocatedNewMemoryChunk = shouldResizeBuffer(count);
+        const bool allocatedNewMemoryChunk = shouldResizeBuffer(count) &&
+                                             !resizeBufferInPlace(nextCapacity(m_elemCount + count));
 
         // Insert to the end
         if (pos == m_elemCount) {
@@ -138,10 +523,7 @@ private:
             }
         } else {
             const size_t totalElements = m_elemCount + count;
-            const size_t nextCapacity = m_capacity * growthFactor;
-            const size_t actualNewCapacity = std::max(nextCapacity, totalElements);
-
-            T *tmpBuffer = static_cast<T *>(allocMany(actualNewCapacity, sizeof(T)));
+            auto [tmpBuffer, actualNewCapacity] = allocMany(nextCapacity(totalElements));
             T *startOldBuffer = (T *) m_data;
 
             // Left
@@ -157,7 +539,8 @@ private:
             // Right
             moveElemsToOtherBuffer(tmpBuffer, startOldBuffer + pos, end().m_ptr);
 
-            free(m_data);
+            recordRelocation();
+            freeBuffer(m_data, m_capacity);
             tmpBuffer -= (pos + count);
             m_data = (uint8_t *) tmpBuffer;
             m_capacity = actualNewCapacity;
@@ -167,119 +550,244 @@ private:
         return &((T *) m_data)[pos];
     }
 
-    T *insertAt(size_t pos, T &&elem) {
-        // Get pointer to position in memory chunk, allocate new memory if required
-        const bool allocatedNewMemoryChunk = shouldResizeBuffer(1);
+    // Moves the elements of [from, to) amount places to the left, into already vacated memory
+    void shiftElemsLeft(T *from, T *to, size_t amount) {
+        m_stats.onElemsMoved(to - from);
+
+        if constexpr (IsTriviallyRelocatable<T>::value) {
+            std::memmove(from - amount, from, (to - from) * sizeof(T));
+            return;
+        }
+
+        for (T *elem = from; elem != to; elem++) {
+            new(elem - amount)T(std::move(*elem));
+            elem->~T();
+        }
+    }
+
+    template<typename... Args>
+    T *emplaceAt(size_t pos, Args &&... args) {
+        if (shouldResizeBuffer(1) && !resizeBufferInPlace(nextCapacity(m_elemCount + 1))) {
+            if constexpr (IsTriviallyRelocatable<T>::value && HasReallocate<Alloc>::value) {
+                // Built before realloc can invalidate arguments referring to our own elements, relocated bytewise after
+                alignas(T) uint8_t elemStorage[sizeof(T)];
+                T *elem = new(elemStorage)T(std::forward<Args>(args)...);
+
+                try {
+                    growBuffer(1);
+                } catch (...) {
+                    elem->~T();
+                    throw;
+                }
+
+                if (pos != m_elemCount) {
+                    shiftElemsRight(pos, 1);
+                }
+
+                T *insertPtr = (T *) m_data + pos;
+                std::memcpy((void *) insertPtr, elemStorage, sizeof(T));
+                m_elemCount++;
+
+                return insertPtr;
+            } else {
+                return emplaceIntoNewBuffer(pos, std::forward<Args>(args)...);
+            }
+        }
+
+        T *insertPtr = (T *) m_data + pos;
 
-        // Insert to the end
         if (pos == m_elemCount) {
-            T *insertPtr = (T *) growIfNeeded(1);
-            new(insertPtr)T(std::move(elem));
-            elem.~T();
+            new(insertPtr)T(std::forward<Args>(args)...);
             m_elemCount++;
 
-            return &((T *) m_data)[pos];
+            return insertPtr;
         }
 
-        // Elements can be moved when there is no new memory chunk allocated
-        if (!allocatedNewMemoryChunk) {
-            T *movePtr = ((T *) m_data) + pos;
+        // Built before the shift, arguments may refer to the elements which move right
+        alignas(T) uint8_t elemStorage[sizeof(T)];
+        T *elem = new(elemStorage)T(std::forward<Args>(args)...);
 
-            // Shift
+        if constexpr (IsTriviallyRelocatable<T>::value) {
             shiftElemsRight(pos, 1);
-
-            // Insert new elements
-            new(movePtr)T(std::move(elem));
-            elem.~T();
-            m_elemCount++;
+            std::memcpy((void *) insertPtr, elemStorage, sizeof(T));
         } else {
-            const size_t totalElements = m_elemCount + 1;
-            const size_t nextCapacity = m_capacity * growthFactor;
-            const size_t actualNewCapacity = std::max(nextCapacity, totalElements);
+            try {
+                shiftElemsRight(pos, 1);
+            } catch (...) {
+                elem->~T();
+                throw;
+            }
 
-            T *tmpBuffer = static_cast<T *>(allocMany(actualNewCapacity, sizeof(T)));
-            T *startOldBuffer = (T *) m_data;
+            try {
+                new(insertPtr)T(std::move(*elem));
+            } catch (...) {
+                elem->~T();
+                // Close the gap again
+                shiftElemsLeft(insertPtr + 1, (T *) m_data + m_elemCount + 1, 1);
+                throw;
+            }
 
-            // Left
-            moveElemsToOtherBuffer(tmpBuffer, startOldBuffer, startOldBuffer + pos);
+            elem->~T();
+        }
 
-            // New elem insertion
-            tmpBuffer += pos;
-            new(tmpBuffer)T(std::move(elem));
-            elem.~T();
+        m_elemCount++;
+        return insertPtr;
+    }
 
-            // Right
-            moveElemsToOtherBuffer(++tmpBuffer, startOldBuffer + pos, end().m_ptr);
+    // The new element gets constructed first, so arguments referring to our own elements stay valid
+    template<typename... Args>
+    T *emplaceIntoNewBuffer(size_t pos, Args &&... args) {
+        auto [tmpBuffer, actualNewCapacity] = allocMany(nextCapacity(m_elemCount + 1));
 
-            free(m_data);
-            tmpBuffer -= (pos + 1); // Move back to buffer start
-            m_data = (uint8_t *) tmpBuffer;
-            m_capacity = actualNewCapacity;
-            m_elemCount = totalElements;
+        try {
+            new(tmpBuffer + pos)T(std::forward<Args>(args)...);
+        } catch (...) {
+            freeBuffer((uint8_t *) tmpBuffer, actualNewCapacity);
+            throw;
         }
 
-        return &((T *) m_data)[pos];
+        T *startOldBuffer = (T *) m_data;
+
+        // Left
+        moveElemsToOtherBuffer(tmpBuffer, startOldBuffer, startOldBuffer + pos);
+
+        // Right
+        moveElemsToOtherBuffer(tmpBuffer + pos + 1, startOldBuffer + pos, startOldBuffer + m_elemCount);
+
+        recordRelocation();
+        freeBuffer(m_data, m_capacity);
+        m_data = (uint8_t *) tmpBuffer;
+        m_capacity = actualNewCapacity;
+        m_elemCount++;
+
+        return tmpBuffer + pos;
     }
 
-    T *insertAt(size_t pos, const T *elemsRangeBegin, const T *elemsRangeEnd) {
-        // Get pointer to position in memory chunk, allocate new memory if required
-        const size_t elemCount = elemsRangeEnd - elemsRangeBegin;
-        const bool allocatedNewMemoryChunk = m_capacity < m_elemCount + elemCount;
+    // Constructs count elements read from first, already constructed ones get destroyed on failure
+    template<typename InputIt>
+    void constructFromIterator(T *destBuffer, InputIt first, size_t count) {
+        if constexpr (std::contiguous_iterator<InputIt> && std::is_same_v<std::iter_value_t<InputIt>, T> &&
+                      std::is_trivially_copyable_v<T>) {
+            std::memcpy(destBuffer, std::to_address(first), count * sizeof(T));
+            return;
+        }
 
-        // Insert to the end
-        if (pos == m_elemCount) {
-            T *insertPtr = (T *) growIfNeeded(elemCount);
+        size_t constructed = 0;
 
-            for (const T *elem = elemsRangeBegin; elem != elemsRangeEnd; elem++) {
-                new(insertPtr)T(*elem);
-                m_elemCount++;
-                insertPtr++;
+        try {
+            for (; constructed < count; constructed++, ++first) {
+                new(destBuffer + constructed)T(*first);
             }
-        } else {
-            // Elements can be moved when there is no new memory chunk allocated
-            if (!allocatedNewMemoryChunk) {
-                T *movePtr = ((T *) m_data) + pos;
-                // Move stored elements to make space
-                shiftElemsRight(pos, elemCount);
-
-                // Insert new elements
-                for (size_t i = 0; i < elemCount; i++) {
-                    new(movePtr++)T(*(elemsRangeBegin++));
-                    m_elemCount++;
-                }
-            } else {
-                const size_t totalElements = m_elemCount + elemCount;
+        } catch (...) {
+            for (T *elem = destBuffer; elem != destBuffer + constructed; elem++) {
+                elem->~T();
+            }
+            throw;
+        }
+    }
 
-                const size_t nextCapacity = m_capacity * growthFactor;
-                const size_t actualNewCapacity = std::max(nextCapacity, totalElements);
+    // Inserts count elements read from first with at most one growth. Move iterators move the elements
+    template<typename InputIt>
+    T *insertCountedAt(size_t pos, InputIt first, size_t count) {
+        if (count == 0) {
+            return (T *) m_data + pos;
+        }
 
-                T *tmpBuffer = static_cast<T *>(allocMany(actualNewCapacity, sizeof(T)));
-                T *startOldBuffer = (T *) m_data;
+        const bool allocatedNewMemoryChunk = shouldResizeBuffer(count) &&
+                                             !resizeBufferInPlace(nextCapacity(m_elemCount + count));
 
-                // Before new elems insert
-                moveElemsToOtherBuffer(tmpBuffer, startOldBuffer, startOldBuffer + pos);
+        // Elements can be moved when there is no new memory chunk allocated
+        if (!allocatedNewMemoryChunk) {
+            T *insertPtr = (T *) m_data + pos;
 
-                tmpBuffer += pos;
+            // Move stored elements to make space
+            if (pos != m_elemCount) {
+                shiftElemsRight(pos, count);
+            }
 
-                // Insert new elems
-                for (const T *elem = elemsRangeBegin; elem != elemsRangeEnd; elem++) {
-                    new((tmpBuffer)++)T(*(elem));
-                }
+            try {
+                constructFromIterator(insertPtr, std::move(first), count);
+            } catch (...) {
+                // Close the gap again
+                shiftElemsLeft(insertPtr + count, (T *) m_data + m_elemCount + count, count);
+                throw;
+            }
+
+            m_elemCount += count;
+            return insertPtr;
+        }
+
+        auto [tmpBuffer, actualNewCapacity] = allocMany(nextCapacity(m_elemCount + count));
+
+        // Insert new elems first, the old buffer stays untouched on failure
+        try {
+            constructFromIterator(tmpBuffer + pos, std::move(first), count);
+        } catch (...) {
+            freeBuffer((uint8_t *) tmpBuffer, actualNewCapacity);
+            throw;
+        }
+
+        T *startOldBuffer = (T *) m_data;
+
+        // Before new elems insert
+        moveElemsToOtherBuffer(tmpBuffer, startOldBuffer, startOldBuffer + pos);
+
+        // After new elems insert
+        moveElemsToOtherBuffer(tmpBuffer + pos + count, startOldBuffer + pos, startOldBuffer + m_elemCount);
 
-                // After new elems insert
-                moveElemsToOtherBuffer(tmpBuffer, startOldBuffer + pos, end().m_ptr);
+        recordRelocation();
+        freeBuffer(m_data, m_capacity);
+        m_data = (uint8_t *) tmpBuffer;
+        m_capacity = actualNewCapacity;
+        m_elemCount += count;
+
+        return tmpBuffer + pos;
+    }
+
+    template<typename InputIt, typename Sentinel>
+    T *insertRangeAt(size_t pos, InputIt first, Sentinel last) {
+        // Counting first is only possible when the range can be traversed twice
+        if constexpr (std::sized_sentinel_for<Sentinel, InputIt> || std::forward_iterator<InputIt>) {
+            const auto count = (size_t) std::ranges::distance(first, last);
+            return insertCountedAt(pos, std::move(first), count);
+        } else {
+            // Single pass, append and rotate the new elements into place
+            const size_t oldCount = m_elemCount;
 
-                free(m_data);
-                tmpBuffer -= (pos + elemCount); // Move back to buffer start
-                m_data = (uint8_t *) tmpBuffer;
-                m_capacity = actualNewCapacity;
-                m_elemCount = totalElements;
+            for (; first != last; ++first) {
+                emplace_back(*first);
             }
+
+            std::rotate(data() + pos, data() + oldCount, data() + m_elemCount);
+            return data() + pos;
+        }
+    }
+
+    template<typename Range>
+    T *insertRangeAt(size_t pos, Range &&range) {
+        // Owning ranges passed as rvalue give up their elements
+        if constexpr (!std::is_lvalue_reference_v<Range> && !std::ranges::view<std::remove_cvref_t<Range>>) {
+            if constexpr (std::ranges::sized_range<Range> || std::ranges::forward_range<Range>) {
+                const auto count = (size_t) std::ranges::distance(range);
+                return insertCountedAt(pos, std::make_move_iterator(std::ranges::begin(range)), count);
+            } else {
+                return insertRangeAt(pos, std::make_move_iterator(std::ranges::begin(range)),
+                                     std::move_sentinel(std::ranges::end(range)));
+            }
+        } else if constexpr (std::ranges::sized_range<Range>) {
+            // Size known up front even for single pass ranges
+            return insertCountedAt(pos, std::ranges::begin(range), (size_t) std::ranges::size(range));
+        } else {
+            return insertRangeAt(pos, std::ranges::begin(range), std::ranges::end(range));
         }
-        return &((T *) m_data)[pos];
     }
 
     T *eraseAt(T *elemsRangeBegin, T *elemsRangeEnd) {
+        // Empty range, nothing to shift
+        if (elemsRangeBegin == elemsRangeEnd) {
+            return elemsRangeBegin;
+        }
+
         // No need to fill the gaps
         if (elemsRangeEnd == end().m_ptr) {
             for (const T *elem = elemsRangeBegin; elem != elemsRangeEnd; elem++) {
@@ -296,176 +804,266 @@ private:
         }
 
         const size_t deleteCount = elemsRangeEnd - elemsRangeBegin;
+        shiftElemsLeft(elemsRangeEnd, end().m_ptr, deleteCount);
+
+        m_elemCount -= deleteCount;
+        // The first element after the erased range now sits where the range started
+        return elemsRangeBegin;
+    }
 
-        for (T *elem = elemsRangeEnd; elem != end().m_ptr; elem++) {
+    // Swap and pop, the last element fills the hole so nothing else has to move
+    void eraseUnorderedAt(T *elem) {
+        T *last = data() + m_elemCount - 1;
 
-            new(elem - deleteCount)T(std::move(*elem));
+        if (elem != last) {
+            if constexpr (IsTriviallyRelocatable<T>::value) {
+                elem->~T();
+                std::memcpy((void *) elem, (const void *) last, sizeof(T));
+            } else {
+                *elem = std::move(*last);
+                last->~T();
+            }
+
+            m_stats.onElemsMoved(1);
+        } else {
             elem->~T();
         }
 
-        m_elemCount -= elemsRangeEnd - elemsRangeBegin;
-        return elemsRangeEnd;
+        m_elemCount--;
+    }
+
+    // Bulk erase bookkeeping, survivors between two erased elements are moved down as one run
+    // so k scattered erases cost a single pass instead of k tail shifts
+    struct Compaction {
+        T *write;
+        T *runBegin;
+    };
+
+    void compactErase(Compaction &compaction, T *elem) {
+        if (compaction.write != compaction.runBegin) {
+            shiftElemsLeft(compaction.runBegin, elem, compaction.runBegin - compaction.write);
+        }
+
+        compaction.write += elem - compaction.runBegin;
+        elem->~T();
+        compaction.runBegin = elem + 1;
+    }
+
+    // Moves the last survivor run down and closes the gaps, also used when a predicate throws
+    size_t finishCompaction(Compaction &compaction) {
+        T *elemsEnd = data() + m_elemCount;
+
+        if (compaction.write != compaction.runBegin) {
+            shiftElemsLeft(compaction.runBegin, elemsEnd, compaction.runBegin - compaction.write);
+        }
+
+        const size_t erasedCount = compaction.runBegin - compaction.write;
+        m_elemCount -= erasedCount;
+
+        return erasedCount;
     }
 
 public:
-    // Iterators
+    // Iterators, contiguous so the standard algorithms can work on the raw memory
     struct iterator {
-        template<typename> friend
-        class Vector;
+        friend class Vector;
 
-        using Category = std::forward_iterator_tag;
-        using Distance = std::ptrdiff_t;
+        using iterator_concept = std::contiguous_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
+        using difference_type = std::ptrdiff_t;
         using value_type = T;
-        using Pointer = T *;
-        using Reference = T &;
+        using pointer = T *;
+        using reference = T &;
 
-        explicit iterator(Pointer ptr) : m_ptr{ptr} {}
+        iterator() = default;
 
-        Reference operator*() const {
+        explicit iterator(pointer ptr) : m_ptr{ptr} {}
+
+        reference operator*() const {
             return *m_ptr;
         }
 
-        Pointer operator->() const {
+        pointer operator->() const {
             return m_ptr;
         }
 
+        reference operator[](difference_type index) const {
+            return m_ptr[index];
+        }
+
         // ++it
-        Vector<T>::iterator &operator++() {
+        iterator &operator++() {
             ++m_ptr;
             return *this;
         }
 
         // it++;
-        Vector<T>::iterator operator++(int) {
+        iterator operator++(int) {
             iterator tmp = *this;
             ++m_ptr;
             return tmp;
         }
 
         // --it
-        Vector<T>::iterator &operator--() {
+        iterator &operator--() {
             --m_ptr;
             return *this;
         }
 
-        Vector<T>::iterator operator--(int) {
+        iterator operator--(int) {
             iterator tmp = *this;
             --m_ptr;
             return tmp;
         }
 
-        Vector<T>::iterator &operator+=(size_t rhs) {
+        iterator &operator+=(difference_type rhs) {
             m_ptr += rhs;
             return *this;
         }
 
-        Vector<T>::iterator &operator-=(size_t rhs) {
+        iterator &operator-=(difference_type rhs) {
             m_ptr -= rhs;
             return *this;
         }
 
-        friend bool operator==(const iterator &lhs, const iterator &rhs) {
-            return lhs.m_ptr == rhs.m_ptr;
+        friend iterator operator+(iterator lhs, difference_type rhs) {
+            return lhs += rhs;
+        }
+
+        friend iterator operator+(difference_type lhs, iterator rhs) {
+            return rhs += lhs;
+        }
+
+        friend iterator operator-(iterator lhs, difference_type rhs) {
+            return lhs -= rhs;
         }
 
-        friend bool operator!=(const iterator &lhs, const iterator &rhs) {
-            return lhs.m_ptr != rhs.m_ptr;
+        friend difference_type operator-(const iterator &lhs, const iterator &rhs) {
+            return lhs.m_ptr - rhs.m_ptr;
         }
 
+        friend bool operator==(const iterator &lhs, const iterator &rhs) = default;
+
+        friend auto operator<=>(const iterator &lhs, const iterator &rhs) = default;
+
     private:
-        Pointer m_ptr;
+        pointer m_ptr{};
     };
 
     struct const_iterator {
-        template<typename> friend
-        class Vector;
+        friend class Vector;
 
-        using Category = std::forward_iterator_tag;
-        using Distance = std::ptrdiff_t;
+        using iterator_concept = std::contiguous_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
+        using difference_type = std::ptrdiff_t;
         using value_type = T;
-        using Pointer = const T *;
-        using Reference = const T &;
+        using pointer = const T *;
+        using reference = const T &;
+
+        const_iterator() = default;
+
+        explicit const_iterator(pointer ptr) : m_ptr{ptr} {}
 
-        explicit const_iterator(Pointer ptr) : m_ptr{ptr} {}
+        // iterator -> const_iterator
+        const_iterator(const iterator &other) : m_ptr{other.m_ptr} {}
 
-        Reference operator*() const {
+        reference operator*() const {
             return *m_ptr;
         }
 
-        Pointer operator->() const {
+        pointer operator->() const {
             return m_ptr;
         }
 
+        reference operator[](difference_type index) const {
+            return m_ptr[index];
+        }
+
         // ++it
-        Vector<T>::const_iterator &operator++() {
+        const_iterator &operator++() {
             ++m_ptr;
             return *this;
         }
 
         // it++;
-        Vector<T>::const_iterator operator++(int) {
+        const_iterator operator++(int) {
             const_iterator tmp = *this;
             ++m_ptr;
             return tmp;
         }
 
         // --it
-        Vector<T>::const_iterator &operator--() {
+        const_iterator &operator--() {
             --m_ptr;
             return *this;
         }
 
-        Vector<T>::const_iterator operator--(int) {
-            iterator tmp = *this;
+        const_iterator operator--(int) {
+            const_iterator tmp = *this;
             --m_ptr;
             return tmp;
         }
 
-        Vector<T>::const_iterator &operator+=(size_t rhs) {
+        const_iterator &operator+=(difference_type rhs) {
             m_ptr += rhs;
             return *this;
         }
 
-        Vector<T>::const_iterator &operator-=(size_t rhs) {
+        const_iterator &operator-=(difference_type rhs) {
             m_ptr -= rhs;
             return *this;
         }
 
-        friend bool operator==(const const_iterator &lhs, const const_iterator &rhs) {
-            return lhs.m_ptr == rhs.m_ptr;
+        friend const_iterator operator+(const_iterator lhs, difference_type rhs) {
+            return lhs += rhs;
         }
 
-        friend bool operator!=(const const_iterator &lhs, const const_iterator &rhs) {
-            return lhs.m_ptr != rhs.m_ptr;
+        friend const_iterator operator+(difference_type lhs, const_iterator rhs) {
+            return rhs += lhs;
         }
 
+        friend const_iterator operator-(const_iterator lhs, difference_type rhs) {
+            return lhs -= rhs;
+        }
+
+        friend difference_type operator-(const const_iterator &lhs, const const_iterator &rhs) {
+            return lhs.m_ptr - rhs.m_ptr;
+        }
+
+        friend bool operator==(const const_iterator &lhs, const const_iterator &rhs) = default;
+
+        friend auto operator<=>(const const_iterator &lhs, const const_iterator &rhs) = default;
+
     private:
-        Pointer m_ptr;
+        pointer m_ptr{};
     };
 
+    using value_type = T;
+    using allocator_type = Alloc;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using pointer = T *;
+    using const_pointer = const T *;
+
     // Constructors
     Vector() = default;
 
-    explicit Vector(size_t capacity) {
-        m_capacity = capacity;
+    explicit Vector(const Alloc &alloc) : m_alloc{alloc} {}
 
+    explicit Vector(size_t capacity, const Alloc &alloc = Alloc()) : m_alloc{alloc} {
         // Alloc required memory
-        m_data = static_cast<uint8_t *>(allocMany(capacity, sizeof(T)));
-
-        if (m_data == nullptr) {
-            throw std::bad_alloc();
-        }
+        auto [buffer, actualCapacity] = allocMany(capacity);
+        m_data = (uint8_t *) buffer;
+        m_capacity = actualCapacity;
     }
 
-    Vector(std::initializer_list<T> values) {
-        m_capacity = values.size();
-
+    Vector(std::initializer_list<T> values, const Alloc &alloc = Alloc()) : m_alloc{alloc} {
         // Alloc required memory
-        m_data = static_cast<uint8_t *>(allocMany(m_capacity, sizeof(T)));
-
-        if (m_data == nullptr) {
-            throw std::bad_alloc();
-        }
+        auto [buffer, actualCapacity] = allocMany(values.size());
+        m_data = (uint8_t *) buffer;
+        m_capacity = actualCapacity;
 
         for (const T &value: values) {
             insertElem(value);
@@ -473,107 +1071,137 @@ public:
     }
 
     // Copy ctor
-    Vector(const Vector<T> &other) {
-        size_t elemCount{};
-        T *bufferStart = (T *) allocMany(other.m_capacity, sizeof(T));
+    Vector(const Vector &other) : m_alloc{AllocTraits::select_on_container_copy_construction(other.m_alloc)} {
+        auto [bufferStart, actualCapacity] = allocMany(other.m_capacity);
 
         try {
-            for (const T *elem = other.begin().m_ptr; elem != other.end().m_ptr; elem++) {
-                new(bufferStart++)T(*elem);
-                ++elemCount;
-            }
+            copyElemsToOtherBuffer(bufferStart, other.begin().m_ptr, other.end().m_ptr);
         } catch (...) {
             // Clean up
-            for (T *elem = bufferStart; elem != bufferStart + elemCount; elem++) {
-                elem->~T();
-            }
-
-            free(m_data);
+            freeBuffer((uint8_t *) bufferStart, actualCapacity);
             throw;
         }
 
-        m_elemCount = elemCount;
-        m_capacity = other.m_capacity;
-        bufferStart -= m_elemCount;
         m_data = (uint8_t *) bufferStart;
+        m_elemCount = other.m_elemCount;
+        m_capacity = actualCapacity;
     }
 
     // Copy assignment
-    Vector<T> &operator=(const Vector<T> &rhs) {
+    Vector &operator=(const Vector &rhs) {
         if (this == &rhs) {
             return *this;
         }
 
-        T *bufferToStore{};
-        size_t capacityToStore{};
-        size_t elemCount{};
+        if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+            // Memory has to be given back to the allocator it came from
+            if (m_alloc != rhs.m_alloc) {
+                releaseBuffer();
+            }
+
+            m_alloc = rhs.m_alloc;
+        }
 
         // No need to allocate new memory
-        if (m_capacity >= rhs.m_capacity) {
+        if (m_capacity >= rhs.m_elemCount) {
+            const size_t assignCount = std::min(m_elemCount, rhs.m_elemCount);
+            T *elems = data();
+            const T *rhsElems = rhs.data();
+
+            // We can use copy assignment for the elems already constructed
+            for (size_t i = 0; i < assignCount; i++) {
+                elems[i] = rhsElems[i];
+            }
+
             if (m_elemCount > rhs.m_elemCount) {
-                // We can use copy assignment for the elems to be inserted
                 destructElems(rhs.m_elemCount, m_elemCount);
+            } else {
+                copyElemsToOtherBuffer(elems + m_elemCount, rhsElems + m_elemCount, rhsElems + rhs.m_elemCount);
             }
 
-            bufferToStore = begin().m_ptr;
-            capacityToStore = m_capacity;
-        } else {
-            destructElems(0, m_elemCount);
-
-            m_elemCount = 0;
-            m_capacity = 0;
-            m_data = nullptr;
-            free(m_data);
-
-            T *bufferStart = (T *) allocMany(rhs.m_capacity, sizeof(T));
-            bufferToStore = bufferStart;
-            capacityToStore = rhs.m_capacity;
+            m_elemCount = rhs.m_elemCount;
+            return *this;
         }
 
-        try {
-            for (const T *elem = rhs.begin().m_ptr; elem != rhs.end().m_ptr; elem++) {
-                // Element at the current pos and old memory reused
-                if (m_elemCount >= elemCount && m_capacity >= rhs.m_capacity) {
-                    *(bufferToStore++) = *elem;
-                } else {
-                    new(bufferToStore++)T(*elem);
-                }
+        auto [bufferStart, actualCapacity] = allocMany(rhs.m_capacity);
 
-                ++elemCount;
-            }
+        try {
+            copyElemsToOtherBuffer(bufferStart, rhs.begin().m_ptr, rhs.end().m_ptr);
         } catch (...) {
             // Clean up
-            for (T *elem = bufferToStore - elemCount; elem != bufferToStore + elemCount; elem++) {
-                elem->~T();
-            }
-
-            free(m_data);
+            freeBuffer((uint8_t *) bufferStart, actualCapacity);
             throw;
         }
 
-        m_elemCount = elemCount;
-        bufferToStore -= m_elemCount;
-        m_data = (uint8_t *) bufferToStore;
-        m_capacity = capacityToStore;
+        releaseBuffer();
+
+        m_data = (uint8_t *) bufferStart;
+        m_elemCount = rhs.m_elemCount;
+        m_capacity = actualCapacity;
 
         return *this;
     }
 
     // Move ctor
-    Vector(Vector<T>&& rhs) noexcept {
+    Vector(Vector &&rhs) noexcept(!HasInlineBuffer<Alloc>::value || std::is_nothrow_move_constructible_v<T>)
+            : m_alloc{std::move(rhs.m_alloc)} {
+        // Inline storage stays with its owner, the elements have to follow one by one
+        if (rhs.isInlineBuffer()) {
+            auto [buffer, actualCapacity] = allocMany(rhs.m_elemCount);
+            moveElemsToOtherBuffer(buffer, rhs.data(), rhs.data() + rhs.m_elemCount);
+
+            m_data = (uint8_t *) buffer;
+            m_elemCount = rhs.m_elemCount;
+            m_capacity = actualCapacity;
+
+            rhs.m_elemCount = 0;
+            return;
+        }
+
         m_data = rhs.m_data;
         m_elemCount = rhs.m_elemCount;
         m_capacity = rhs.m_capacity;
 
         rhs.m_data = nullptr;
         rhs.m_elemCount = 0;
-
+        rhs.m_capacity = 0;
     }
 
     // Move assignment
-    Vector<T>& operator=(Vector<T>&& rhs) noexcept {
-        destructElems(0, m_elemCount);
-        free(m_data);
+    Vector &operator=(Vector &&rhs) noexcept((AllocTraits::propagate_on_container_move_assignment::value ||
+                                              AllocTraits::is_always_equal::value) &&
+                                             !HasInlineBuffer<Alloc>::value) {
+        if (this == &rhs) {
+            return *this;
+        }
+
+        // Buffers can only change owner when our allocator is able to free them, inline buffers never do
+        bool moveElementWise = rhs.isInlineBuffer();
+
+        if constexpr (!AllocTraits::propagate_on_container_move_assignment::value &&
+                      !AllocTraits::is_always_equal::value) {
+            moveElementWise = moveElementWise || m_alloc != rhs.m_alloc;
+        }
+
+        if (moveElementWise) {
+            clear();
+
+            if (m_capacity < rhs.m_elemCount) {
+                allocateBuffer(rhs.m_elemCount);
+            }
+
+            moveElemsToOtherBuffer(data(), rhs.data(), rhs.data() + rhs.m_elemCount);
+            m_elemCount = rhs.m_elemCount;
+            rhs.m_elemCount = 0;
+
+            return *this;
+        }
+
+        releaseBuffer();
+
+        if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+            m_alloc = std::move(rhs.m_alloc);
+        }
 
         m_data = rhs.m_data;
         m_elemCount = rhs.m_elemCount;
@@ -592,11 +1220,15 @@ public:
             return;
         }
 
-        for (const T *elem = cbegin().m_ptr; elem != cend().m_ptr; elem++) {
-            elem->~T();
-        }
+        releaseBuffer();
+    }
 
-        free(m_data);
+    Alloc get_allocator() const {
+        return m_alloc;
+    }
+
+    const Stats &stats() const {
+        return m_stats;
     }
 
     // Modifiers
@@ -644,23 +1276,41 @@ public:
         }
 
         const size_t index = pos.m_ptr - begin().m_ptr;
-        T *insertPos = insertAt(index, std::forward<T>(value));
+        T *insertPos = emplaceAt(index, std::move(value));
 
         return iterator{insertPos};
     }
 
-    iterator insert(iterator pos, iterator first, iterator last) {
-        if ((uintptr_t) pos.m_ptr<(uintptr_t) begin().m_ptr || (uintptr_t) pos.m_ptr>(uintptr_t)end().m_ptr) {
-            assert("Iterator pointer out of range");
-        }
+    template<std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+    iterator insert(iterator pos, InputIt first, Sentinel last) {
+        assert(pos.m_ptr >= begin().m_ptr && pos.m_ptr <= end().m_ptr && "Iterator pointer out of range");
 
         const size_t index = pos.m_ptr - begin().m_ptr;
+        T *insertPos = insertRangeAt(index, std::move(first), std::move(last));
+
+        return iterator{insertPos};
+    }
 
-        T *insertPos = insertAt(index, first.m_ptr, last.m_ptr);
+    template<std::ranges::input_range Range>
+    iterator insert_range(iterator pos, Range &&range) {
+        assert(pos.m_ptr >= begin().m_ptr && pos.m_ptr <= end().m_ptr && "Iterator pointer out of range");
+
+        const size_t index = pos.m_ptr - begin().m_ptr;
+        T *insertPos = insertRangeAt(index, std::forward<Range>(range));
 
         return iterator{insertPos};
     }
 
+    template<std::ranges::input_range Range>
+    void append_range(Range &&range) {
+        insertRangeAt(m_elemCount, std::forward<Range>(range));
+    }
+
+    template<std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+    void append_range(InputIt first, Sentinel last) {
+        insertRangeAt(m_elemCount, std::move(first), std::move(last));
+    }
+
     iterator erase(iterator pos) {
         T *deletePos = pos.m_ptr;
         return iterator{eraseAt(deletePos, deletePos + 1)};
@@ -673,19 +1323,171 @@ public:
         return iterator{eraseAt(from, to)};
     }
 
+    // Erases all elements matching the predicate in a single pass, returns the erased count
+    template<typename Predicate>
+    size_t erase_if(Predicate pred) {
+        Compaction compaction{data(), data()};
+        T *elemsEnd = data() + m_elemCount;
+
+        try {
+            for (T *elem = data(); elem != elemsEnd; elem++) {
+                if (pred(std::as_const(*elem))) {
+                    compactErase(compaction, elem);
+                }
+            }
+        } catch (...) {
+            finishCompaction(compaction);
+            throw;
+        }
+
+        return finishCompaction(compaction);
+    }
+
+    // Erases the elements at the given indices in a single pass, indices have to be sorted ascending.
+    // Duplicates are ignored, returns the erased count
+    size_t erase_indices(std::span<const size_t> indices) {
+        if (indices.empty()) {
+            return 0;
+        }
+
+        if (!std::is_sorted(indices.begin(), indices.end())) {
+            throw std::invalid_argument("Indices have to be sorted");
+        }
+
+        if (indices.back() >= m_elemCount) {
+            throw std::out_of_range("Out of range");
+        }
+
+        Compaction compaction{data(), data()};
+
+        for (const size_t index: indices) {
+            T *elem = data() + index;
+
+            // Duplicate of an already erased index
+            if (elem < compaction.runBegin) {
+                continue;
+            }
+
+            compactErase(compaction, elem);
+        }
+
+        return finishCompaction(compaction);
+    }
+
+    // Order is not preserved, the returned iterator points to the element moved into the erased position
+    iterator erase_unordered(iterator pos) {
+        T *erasePos = pos.m_ptr;
+        eraseUnorderedAt(erasePos);
+
+        return iterator{erasePos};
+    }
+
+    void erase_unordered(size_t index) {
+        if (index >= m_elemCount) {
+            throw std::out_of_range("Out of range");
+        }
+
+        eraseUnorderedAt(data() + index);
+    }
+
+    // Indices have to be sorted ascending, they get processed from the back so elements moved into
+    // the holes always come from behind the indices still to be processed. Duplicates are ignored
+    void erase_unordered(std::span<const size_t> indices) {
+        if (indices.empty()) {
+            return;
+        }
+
+        if (!std::is_sorted(indices.begin(), indices.end())) {
+            throw std::invalid_argument("Indices have to be sorted");
+        }
+
+        if (indices.back() >= m_elemCount) {
+            throw std::out_of_range("Out of range");
+        }
+
+        size_t lastErased = m_elemCount;
+
+        for (auto index = indices.rbegin(); index != indices.rend(); index++) {
+            if (*index == lastErased) {
+                continue;
+            }
+
+            eraseUnorderedAt(data() + *index);
+            lastErased = *index;
+        }
+    }
+
+    friend size_t erase_if(Vector &vector, auto pred) {
+        return vector.erase_if(std::move(pred));
+    }
+
+    template<typename... Args>
+    iterator emplace(iterator pos, Args &&... args) {
+        assert(pos.m_ptr >= begin().m_ptr && pos.m_ptr <= end().m_ptr && "Iterator pointer out of range");
+
+        const size_t index = pos.m_ptr - begin().m_ptr;
+        T *insertPos = emplaceAt(index, std::forward<Args>(args)...);
+
+        return iterator{insertPos};
+    }
+
     void push_back(const T &value) {
-        insertElem(value);
+        emplace_back(value);
     }
 
     void push_back(T &&value) {
-        emplace_back(std::forward<T>(value));
+        emplace_back(std::move(value));
     }
 
-    void emplace_back(T &&value) {
-        uint8_t *insertPtr = growIfNeeded(1);
-        new(insertPtr)T(std::move(value));
+    template<typename... Args>
+    T &emplace_back(Args &&... args) {
+        return *emplaceAt(m_elemCount, std::forward<Args>(args)...);
+    }
 
-        m_elemCount++;
+    // New elements get value initialized
+    void resize(size_t count) {
+        if (count <= m_elemCount) {
+            destructElems(count, m_elemCount);
+            m_elemCount = count;
+            return;
+        }
+
+        growIfNeeded(count - m_elemCount);
+        std::uninitialized_value_construct_n(data() + m_elemCount, count - m_elemCount);
+        m_elemCount = count;
+    }
+
+    void resize(size_t count, const T &value) {
+        if (count <= m_elemCount) {
+            destructElems(count, m_elemCount);
+            m_elemCount = count;
+            return;
+        }
+
+        // Value might be one of our own elements, growth would invalidate it
+        if (shouldResizeBuffer(count - m_elemCount)) {
+            T valueCopy = value;
+            growIfNeeded(count - m_elemCount);
+            std::uninitialized_fill_n(data() + m_elemCount, count - m_elemCount, valueCopy);
+        } else {
+            std::uninitialized_fill_n(data() + m_elemCount, count - m_elemCount, value);
+        }
+
+        m_elemCount = count;
+    }
+
+    // New elements get default initialized, trivial types stay uninitialized so bulk reads
+    // can write straight into the buffer without zeroing it first
+    void resize_for_overwrite(size_t count) {
+        if (count <= m_elemCount) {
+            destructElems(count, m_elemCount);
+            m_elemCount = count;
+            return;
+        }
+
+        growIfNeeded(count - m_elemCount);
+        std::uninitialized_default_construct_n(data() + m_elemCount, count - m_elemCount);
+        m_elemCount = count;
     }
 
     void pop_back() {
@@ -698,6 +1500,30 @@ public:
         m_elemCount--;
     }
 
+    void swap(Vector &other) noexcept(!HasInlineBuffer<Alloc>::value) {
+        // Inline buffers can't be exchanged, their elements get moved instead
+        if (isInlineBuffer() || other.isInlineBuffer()) {
+            Vector tmp{std::move(other)};
+            other = std::move(*this);
+            *this = std::move(tmp);
+            return;
+        }
+
+        // Without propagation both allocators have to compare equal, like for the std containers
+        if constexpr (AllocTraits::propagate_on_container_swap::value) {
+            using std::swap;
+            swap(m_alloc, other.m_alloc);
+        }
+
+        std::swap(m_data, other.m_data);
+        std::swap(m_elemCount, other.m_elemCount);
+        std::swap(m_capacity, other.m_capacity);
+    }
+
+    friend void swap(Vector &lhs, Vector &rhs) noexcept(noexcept(lhs.swap(rhs))) {
+        lhs.swap(rhs);
+    }
+
     // Element access
     T &at(size_t pos) const {
         if (pos >= m_elemCount) {
@@ -727,8 +1553,12 @@ public:
         return ((T *) m_data)[m_elemCount - 1];
     }
 
-    T *data() const {
-        return (T *) reinterpret_cast<int *>(m_data);
+    T *data() {
+        return (T *) m_data;
+    }
+
+    const T *data() const {
+        return (const T *) m_data;
     }
 
     // Capacity
@@ -753,6 +1583,11 @@ public:
     }
 
     void shrink_to_fit() {
+        // Inline storage can't be given back
+        if (isInlineBuffer()) {
+            return;
+        }
+
         allocateBuffer(m_elemCount);
     }
 
@@ -781,4 +1616,11 @@ public:
     }
 };
 
+// Buffer aligned to Alignment bytes, e.g. 64 for AVX-512 loads or 4096 for page aligned I/O
+template<typename T, size_t Alignment, GrowthPolicy Growth = GrowthFactor<3, 2>>
+using AlignedVector = Vector<T, MallocAllocator<T, Alignment>, Growth>;
+
+template<typename T, GrowthPolicy Growth = GrowthFactor<3, 2>>
+using PmrVector = Vector<T, std::pmr::polymorphic_allocator<T>, Growth>;
+
 #endif //VECTOR_VECTOR_H
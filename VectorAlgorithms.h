@@ -0,0 +1,673 @@
+//
+// Created by Sebastian on 16.10.2026.
+//
+
+#ifndef VECTOR_VECTORALGORITHMS_H
+#define VECTOR_VECTORALGORITHMS_H
+
+#include "Vector.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define VECTOR_SIMD_X86
+
+#include <immintrin.h>
+#endif
+
+// Instruction sets the search and reduction kernels can use, ordered from weakest to strongest
+enum class SimdLevel {
+    Scalar,
+    Sse2,
+    Avx2,
+    Avx512
+};
+
+// Detected once, the kernels are compiled per instruction set and picked at runtime
+inline SimdLevel supportedSimdLevel() {
+#ifdef VECTOR_SIMD_X86
+    static const SimdLevel level = [] {
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("avx512f")) {
+            return SimdLevel::Avx512;
+        }
+
+        if (__builtin_cpu_supports("avx2")) {
+            return SimdLevel::Avx2;
+        }
+
+        if (__builtin_cpu_supports("sse2")) {
+            return SimdLevel::Sse2;
+        }
+
+        return SimdLevel::Scalar;
+    }();
+
+    return level;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+// Sums are accumulated in a wider type, so int32_t sums don't overflow and float sums keep their precision
+template<typename T>
+using SimdSumType = std::conditional_t<std::is_floating_point_v<T>, double,
+        std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>>;
+
+// Scalar reference implementations, also used for the tails and element types without kernels
+struct ScalarKernels {
+    template<typename T>
+    static size_t find(const T *elems, size_t from, size_t count, T value) {
+        for (size_t i = from; i < count; i++) {
+            if (elems[i] == value) {
+                return i;
+            }
+        }
+
+        return count;
+    }
+
+    template<typename T>
+    static size_t count(const T *elems, size_t from, size_t count, T value) {
+        size_t matches = 0;
+
+        for (size_t i = from; i < count; i++) {
+            matches += elems[i] == value;
+        }
+
+        return matches;
+    }
+
+    template<typename T>
+    static T min(const T *elems, size_t from, size_t count, T init) {
+        for (size_t i = from; i < count; i++) {
+            init = elems[i] < init ? elems[i] : init;
+        }
+
+        return init;
+    }
+
+    template<typename T>
+    static T max(const T *elems, size_t from, size_t count, T init) {
+        for (size_t i = from; i < count; i++) {
+            init = elems[i] > init ? elems[i] : init;
+        }
+
+        return init;
+    }
+
+    template<typename T>
+    static SimdSumType<T> sum(const T *elems, size_t from, size_t count) {
+        SimdSumType<T> sum{};
+
+        for (size_t i = from; i < count; i++) {
+            sum += elems[i];
+        }
+
+        return sum;
+    }
+};
+
+#ifdef VECTOR_SIMD_X86
+
+// GCC 12 reports the placeholder registers inside its own AVX-512 extract and reduce intrinsics as uninitialized
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+// Kernels for the element types with vector instructions, every loop leaves the remainder to ScalarKernels
+struct SimdKernels {
+    // SSE2, part of every x86-64 CPU
+    __attribute__((target("sse2")))
+    static size_t findSse2(const int32_t *elems, size_t count, int32_t value) {
+        const __m128i needle = _mm_set1_epi32(value);
+        size_t i = 0;
+
+        for (; i + 4 <= count; i += 4) {
+            const __m128i matches = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *) (elems + i)), needle);
+            const int mask = _mm_movemask_ps(_mm_castsi128_ps(matches));
+
+            if (mask != 0) {
+                return i + std::countr_zero((unsigned) mask);
+            }
+        }
+
+        return ScalarKernels::find(elems, i, count, value);
+    }
+
+    __attribute__((target("sse2")))
+    static size_t findSse2(const float *elems, size_t count, float value) {
+        const __m128 needle = _mm_set1_ps(value);
+        size_t i = 0;
+
+        for (; i + 4 <= count; i += 4) {
+            const int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(elems + i), needle));
+
+            if (mask != 0) {
+                return i + std::countr_zero((unsigned) mask);
+            }
+        }
+
+        return ScalarKernels::find(elems, i, count, value);
+    }
+
+    __attribute__((target("sse2")))
+    static size_t countSse2(const int32_t *elems, size_t count, int32_t value) {
+        const __m128i needle = _mm_set1_epi32(value);
+        size_t matches = 0;
+        size_t i = 0;
+
+        for (; i + 4 <= count; i += 4) {
+            const __m128i equal = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *) (elems + i)), needle);
+            matches += std::popcount((unsigned) _mm_movemask_ps(_mm_castsi128_ps(equal)));
+        }
+
+        return matches + ScalarKernels::count(elems, i, count, value);
+    }
+
+    __attribute__((target("sse2")))
+    static size_t countSse2(const float *elems, size_t count, float value) {
+        const __m128 needle = _mm_set1_ps(value);
+        size_t matches = 0;
+        size_t i = 0;
+
+        for (; i + 4 <= count; i += 4) {
+            matches += std::popcount((unsigned) _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(elems + i), needle)));
+        }
+
+        return matches + ScalarKernels::count(elems, i, count, value);
+    }
+
+    // SSE2 has no 32 bit integer min and max, selected through the comparison mask instead
+    __attribute__((target("sse2")))
+    static int32_t minSse2(const int32_t *elems, size_t count) {
+        __m128i min = _mm_loadu_si128((const __m128i *) elems);
+        size_t i = 4;
+
+        for (; i + 4 <= count; i += 4) {
+            const __m128i values = _mm_loadu_si128((const __m128i *) (elems + i));
+            const __m128i less = _mm_cmplt_epi32(values, min);
+            min = _mm_or_si128(_mm_and_si128(less, values), _mm_andnot_si128(less, min));
+        }
+
+        alignas(16) int32_t lanes[4];
+        _mm_store_si128((__m128i *) lanes, min);
+
+        return ScalarKernels::min(elems, i, count, ScalarKernels::min(lanes, 1, 4, lanes[0]));
+    }
+
+    __attribute__((target("sse2")))
+    static float minSse2(const float *elems, size_t count) {
+        __m128 min = _mm_loadu_ps(elems);
+        size_t i = 4;
+
+        for (; i + 4 <= count; i += 4) {
+            min = _mm_min_ps(min, _mm_loadu_ps(elems + i));
+        }
+
+        alignas(16) float lanes[4];
+        _mm_store_ps(lanes, min);
+
+        return ScalarKernels::min(elems, i, count, ScalarKernels::min(lanes, 1, 4, lanes[0]));
+    }
+
+    __attribute__((target("sse2")))
+    static int32_t maxSse2(const int32_t *elems, size_t count) {
+        __m128i max = _mm_loadu_si128((const __m128i *) elems);
+        size_t i = 4;
+
+        for (; i + 4 <= count; i += 4) {
+            const __m128i values = _mm_loadu_si128((const __m128i *) (elems + i));
+            const __m128i greater = _mm_cmpgt_epi32(values, max);
+            max = _mm_or_si128(_mm_and_si128(greater, values), _mm_andnot_si128(greater, max));
+        }
+
+        alignas(16) int32_t lanes[4];
+        _mm_store_si128((__m128i *) lanes, max);
+
+        return ScalarKernels::max(elems, i, count, ScalarKernels::max(lanes, 1, 4, lanes[0]));
+    }
+
+    __attribute__((target("sse2")))
+    static float maxSse2(const float *elems, size_t count) {
+        __m128 max = _mm_loadu_ps(elems);
+        size_t i = 4;
+
+        for (; i + 4 <= count; i += 4) {
+            max = _mm_max_ps(max, _mm_loadu_ps(elems + i));
+        }
+
+        alignas(16) float lanes[4];
+        _mm_store_ps(lanes, max);
+
+        return ScalarKernels::max(elems, i, count, ScalarKernels::max(lanes, 1, 4, lanes[0]));
+    }
+
+    // Sign extended to 64 bit lanes by interleaving with the sign mask
+    __attribute__((target("sse2")))
+    static int64_t sumSse2(const int32_t *elems, size_t count) {
+        __m128i sum = _mm_setzero_si128();
+        size_t i = 0;
+
+        for (; i + 4 <= count; i += 4) {
+            const __m128i values = _mm_loadu_si128((const __m128i *) (elems + i));
+            const __m128i sign = _mm_srai_epi32(values, 31);
+            sum = _mm_add_epi64(sum, _mm_unpacklo_epi32(values, sign));
+            sum = _mm_add_epi64(sum, _mm_unpackhi_epi32(values, sign));
+        }
+
+        alignas(16) int64_t lanes[2];
+        _mm_store_si128((__m128i *) lanes, sum);
+
+        return lanes[0] + lanes[1] + ScalarKernels::sum(elems, i, count);
+    }
+
+    __attribute__((target("sse2")))
+    static double sumSse2(const float *elems, size_t count) {
+        __m128d sum = _mm_setzero_pd();
+        size_t i = 0;
+
+        for (; i + 4 <= count; i += 4) {
+            const __m128 values = _mm_loadu_ps(elems + i);
+            sum = _mm_add_pd(sum, _mm_cvtps_pd(values));
+            sum = _mm_add_pd(sum, _mm_cvtps_pd(_mm_movehl_ps(values, values)));
+        }
+
+        alignas(16) double lanes[2];
+        _mm_store_pd(lanes, sum);
+
+        return lanes[0] + lanes[1] + ScalarKernels::sum(elems, i, count);
+    }
+
+    // AVX2
+    __attribute__((target("avx2")))
+    static size_t findAvx2(const int32_t *elems, size_t count, int32_t value) {
+        const __m256i needle = _mm256_set1_epi32(value);
+        size_t i = 0;
+
+        for (; i + 8 <= count; i += 8) {
+            const __m256i matches = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *) (elems + i)), needle);
+            const int mask = _mm256_movemask_ps(_mm256_castsi256_ps(matches));
+
+            if (mask != 0) {
+                return i + std::countr_zero((unsigned) mask);
+            }
+        }
+
+        return ScalarKernels::find(elems, i, count, value);
+    }
+
+    __attribute__((target("avx2")))
+    static size_t findAvx2(const float *elems, size_t count, float value) {
+        const __m256 needle = _mm256_set1_ps(value);
+        size_t i = 0;
+
+        for (; i + 8 <= count; i += 8) {
+            const int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(elems + i), needle, _CMP_EQ_OQ));
+
+            if (mask != 0) {
+                return i + std::countr_zero((unsigned) mask);
+            }
+        }
+
+        return ScalarKernels::find(elems, i, count, value);
+    }
+
+    __attribute__((target("avx2,popcnt")))
+    static size_t countAvx2(const int32_t *elems, size_t count, int32_t value) {
+        const __m256i needle = _mm256_set1_epi32(value);
+        size_t matches = 0;
+        size_t i = 0;
+
+        for (; i + 8 <= count; i += 8) {
+            const __m256i equal = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *) (elems + i)), needle);
+            matches += std::popcount((unsigned) _mm256_movemask_ps(_mm256_castsi256_ps(equal)));
+        }
+
+        return matches + ScalarKernels::count(elems, i, count, value);
+    }
+
+    __attribute__((target("avx2,popcnt")))
+    static size_t countAvx2(const float *elems, size_t count, float value) {
+        const __m256 needle = _mm256_set1_ps(value);
+        size_t matches = 0;
+        size_t i = 0;
+
+        for (; i + 8 <= count; i += 8) {
+            const __m256 equal = _mm256_cmp_ps(_mm256_loadu_ps(elems + i), needle, _CMP_EQ_OQ);
+            matches += std::popcount((unsigned) _mm256_movemask_ps(equal));
+        }
+
+        return matches + ScalarKernels::count(elems, i, count, value);
+    }
+
+    __attribute__((target("avx2")))
+    static int32_t minAvx2(const int32_t *elems, size_t count) {
+        __m256i min = _mm256_loadu_si256((const __m256i *) elems);
+        size_t i = 8;
+
+        for (; i + 8 <= count; i += 8) {
+            min = _mm256_min_epi32(min, _mm256_loadu_si256((const __m256i *) (elems + i)));
+        }
+
+        alignas(32) int32_t lanes[8];
+        _mm256_store_si256((__m256i *) lanes, min);
+
+        return ScalarKernels::min(elems, i, count, ScalarKernels::min(lanes, 1, 8, lanes[0]));
+    }
+
+    __attribute__((target("avx2")))
+    static float minAvx2(const float *elems, size_t count) {
+        __m256 min = _mm256_loadu_ps(elems);
+        size_t i = 8;
+
+        for (; i + 8 <= count; i += 8) {
+            min = _mm256_min_ps(min, _mm256_loadu_ps(elems + i));
+        }
+
+        alignas(32) float lanes[8];
+        _mm256_store_ps(lanes, min);
+
+        return ScalarKernels::min(elems, i, count, ScalarKernels::min(lanes, 1, 8, lanes[0]));
+    }
+
+    __attribute__((target("avx2")))
+    static int32_t maxAvx2(const int32_t *elems, size_t count) {
+        __m256i max = _mm256_loadu_si256((const __m256i *) elems);
+        size_t i = 8;
+
+        for (; i + 8 <= count; i += 8) {
+            max = _mm256_max_epi32(max, _mm256_loadu_si256((const __m256i *) (elems + i)));
+        }
+
+        alignas(32) int32_t lanes[8];
+        _mm256_store_si256((__m256i *) lanes, max);
+
+        return ScalarKernels::max(elems, i, count, ScalarKernels::max(lanes, 1, 8, lanes[0]));
+    }
+
+    __attribute__((target("avx2")))
+    static float maxAvx2(const float *elems, size_t count) {
+        __m256 max = _mm256_loadu_ps(elems);
+        size_t i = 8;
+
+        for (; i + 8 <= count; i += 8) {
+            max = _mm256_max_ps(max, _mm256_loadu_ps(elems + i));
+        }
+
+        alignas(32) float lanes[8];
+        _mm256_store_ps(lanes, max);
+
+        return ScalarKernels::max(elems, i, count, ScalarKernels::max(lanes, 1, 8, lanes[0]));
+    }
+
+    __attribute__((target("avx2")))
+    static int64_t sumAvx2(const int32_t *elems, size_t count) {
+        __m256i sum = _mm256_setzero_si256();
+        size_t i = 0;
+
+        for (; i + 8 <= count; i += 8) {
+            const __m256i values = _mm256_loadu_si256((const __m256i *) (elems + i));
+            sum = _mm256_add_epi64(sum, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(values)));
+            sum = _mm256_add_epi64(sum, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(values, 1)));
+        }
+
+        alignas(32) int64_t lanes[4];
+        _mm256_store_si256((__m256i *) lanes, sum);
+
+        return lanes[0] + lanes[1] + lanes[2] + lanes[3] + ScalarKernels::sum(elems, i, count);
+    }
+
+    __attribute__((target("avx2")))
+    static double sumAvx2(const float *elems, size_t count) {
+        __m256d sum = _mm256_setzero_pd();
+        size_t i = 0;
+
+        for (; i + 8 <= count; i += 8) {
+            const __m256 values = _mm256_loadu_ps(elems + i);
+            sum = _mm256_add_pd(sum, _mm256_cvtps_pd(_mm256_castps256_ps128(values)));
+            sum = _mm256_add_pd(sum, _mm256_cvtps_pd(_mm256_extractf128_ps(values, 1)));
+        }
+
+        alignas(32) double lanes[4];
+        _mm256_store_pd(lanes, sum);
+
+        return lanes[0] + lanes[1] + lanes[2] + lanes[3] + ScalarKernels::sum(elems, i, count);
+    }
+
+    // AVX-512, comparisons produce mask registers directly
+    __attribute__((target("avx512f")))
+    static size_t findAvx512(const int32_t *elems, size_t count, int32_t value) {
+        const __m512i needle = _mm512_set1_epi32(value);
+        size_t i = 0;
+
+        for (; i + 16 <= count; i += 16) {
+            const __mmask16 mask = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(elems + i), needle);
+
+            if (mask != 0) {
+                return i + std::countr_zero((unsigned) mask);
+            }
+        }
+
+        return ScalarKernels::find(elems, i, count, value);
+    }
+
+    __attribute__((target("avx512f")))
+    static size_t findAvx512(const float *elems, size_t count, float value) {
+        const __m512 needle = _mm512_set1_ps(value);
+        size_t i = 0;
+
+        for (; i + 16 <= count; i += 16) {
+            const __mmask16 mask = _mm512_cmp_ps_mask(_mm512_loadu_ps(elems + i), needle, _CMP_EQ_OQ);
+
+            if (mask != 0) {
+                return i + std::countr_zero((unsigned) mask);
+            }
+        }
+
+        return ScalarKernels::find(elems, i, count, value);
+    }
+
+    __attribute__((target("avx512f,popcnt")))
+    static size_t countAvx512(const int32_t *elems, size_t count, int32_t value) {
+        const __m512i needle = _mm512_set1_epi32(value);
+        size_t matches = 0;
+        size_t i = 0;
+
+        for (; i + 16 <= count; i += 16) {
+            matches += std::popcount((unsigned) _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(elems + i), needle));
+        }
+
+        return matches + ScalarKernels::count(elems, i, count, value);
+    }
+
+    __attribute__((target("avx512f,popcnt")))
+    static size_t countAvx512(const float *elems, size_t count, float value) {
+        const __m512 needle = _mm512_set1_ps(value);
+        size_t matches = 0;
+        size_t i = 0;
+
+        for (; i + 16 <= count; i += 16) {
+            matches += std::popcount((unsigned) _mm512_cmp_ps_mask(_mm512_loadu_ps(elems + i), needle, _CMP_EQ_OQ));
+        }
+
+        return matches + ScalarKernels::count(elems, i, count, value);
+    }
+
+    __attribute__((target("avx512f")))
+    static int32_t minAvx512(const int32_t *elems, size_t count) {
+        __m512i min = _mm512_loadu_si512(elems);
+        size_t i = 16;
+
+        for (; i + 16 <= count; i += 16) {
+            min = _mm512_min_epi32(min, _mm512_loadu_si512(elems + i));
+        }
+
+        return ScalarKernels::min(elems, i, count, _mm512_reduce_min_epi32(min));
+    }
+
+    __attribute__((target("avx512f")))
+    static float minAvx512(const float *elems, size_t count) {
+        __m512 min = _mm512_loadu_ps(elems);
+        size_t i = 16;
+
+        for (; i + 16 <= count; i += 16) {
+            min = _mm512_min_ps(min, _mm512_loadu_ps(elems + i));
+        }
+
+        return ScalarKernels::min(elems, i, count, _mm512_reduce_min_ps(min));
+    }
+
+    __attribute__((target("avx512f")))
+    static int32_t maxAvx512(const int32_t *elems, size_t count) {
+        __m512i max = _mm512_loadu_si512(elems);
+        size_t i = 16;
+
+        for (; i + 16 <= count; i += 16) {
+            max = _mm512_max_epi32(max, _mm512_loadu_si512(elems + i));
+        }
+
+        return ScalarKernels::max(elems, i, count, _mm512_reduce_max_epi32(max));
+    }
+
+    __attribute__((target("avx512f")))
+    static float maxAvx512(const float *elems, size_t count) {
+        __m512 max = _mm512_loadu_ps(elems);
+        size_t i = 16;
+
+        for (; i + 16 <= count; i += 16) {
+            max = _mm512_max_ps(max, _mm512_loadu_ps(elems + i));
+        }
+
+        return ScalarKernels::max(elems, i, count, _mm512_reduce_max_ps(max));
+    }
+
+    __attribute__((target("avx512f")))
+    static int64_t sumAvx512(const int32_t *elems, size_t count) {
+        __m512i sum = _mm512_setzero_si512();
+        size_t i = 0;
+
+        for (; i + 16 <= count; i += 16) {
+            const __m512i values = _mm512_loadu_si512(elems + i);
+            sum = _mm512_add_epi64(sum, _mm512_cvtepi32_epi64(_mm512_castsi512_si256(values)));
+            sum = _mm512_add_epi64(sum, _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(values, 1)));
+        }
+
+        return _mm512_reduce_add_epi64(sum) + ScalarKernels::sum(elems, i, count);
+    }
+
+    __attribute__((target("avx512f")))
+    static double sumAvx512(const float *elems, size_t count) {
+        __m512d sum = _mm512_setzero_pd();
+        size_t i = 0;
+
+        for (; i + 16 <= count; i += 16) {
+            const __m512 values = _mm512_loadu_ps(elems + i);
+            const __m256 high = _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(values), 1));
+            sum = _mm512_add_pd(sum, _mm512_cvtps_pd(_mm512_castps512_ps256(values)));
+            sum = _mm512_add_pd(sum, _mm512_cvtps_pd(high));
+        }
+
+        return _mm512_reduce_add_pd(sum) + ScalarKernels::sum(elems, i, count);
+    }
+};
+
+#pragma GCC diagnostic pop
+
+#endif
+
+// Element types with vector kernels, everything else runs the scalar loops
+template<typename T>
+constexpr bool HasSimdKernels = std::is_same_v<T, int32_t> || std::is_same_v<T, float>;
+
+template<typename Range>
+concept ArithmeticContiguousRange = std::ranges::contiguous_range<Range> &&
+                                    std::ranges::sized_range<Range> &&
+                                    std::is_arithmetic_v<std::ranges::range_value_t<Range>>;
+
+// Requested levels above the supported one are clamped, lower ones allow comparing the kernels.
+// Dispatches to the kernel of the level, returns the scalar result otherwise
+#ifdef VECTOR_SIMD_X86
+#define VECTOR_SIMD_DISPATCH(kernel, scalarCall, ...)                                   \
+    if constexpr (HasSimdKernels<T>) {                                                  \
+        switch (std::min(level, supportedSimdLevel())) {                                \
+            case SimdLevel::Avx512: return SimdKernels::kernel##Avx512(__VA_ARGS__);    \
+            case SimdLevel::Avx2: return SimdKernels::kernel##Avx2(__VA_ARGS__);        \
+            case SimdLevel::Sse2: return SimdKernels::kernel##Sse2(__VA_ARGS__);        \
+            case SimdLevel::Scalar: break;                                              \
+        }                                                                               \
+    }                                                                                   \
+    return scalarCall;
+#else
+#define VECTOR_SIMD_DISPATCH(kernel, scalarCall, ...) \
+    (void) level;                                     \
+    return scalarCall;
+#endif
+
+// Index of the first element equal to value, size of the range when there is none
+template<ArithmeticContiguousRange Range>
+size_t simdFind(const Range &range, std::ranges::range_value_t<Range> value, SimdLevel level = supportedSimdLevel()) {
+    using T = std::ranges::range_value_t<Range>;
+    const T *elems = std::ranges::data(range);
+    const size_t count = std::ranges::size(range);
+
+    VECTOR_SIMD_DISPATCH(find, ScalarKernels::find(elems, 0, count, value), elems, count, value)
+}
+
+template<ArithmeticContiguousRange Range>
+size_t simdCount(const Range &range, std::ranges::range_value_t<Range> value, SimdLevel level = supportedSimdLevel()) {
+    using T = std::ranges::range_value_t<Range>;
+    const T *elems = std::ranges::data(range);
+    const size_t count = std::ranges::size(range);
+
+    VECTOR_SIMD_DISPATCH(count, ScalarKernels::count(elems, 0, count, value), elems, count, value)
+}
+
+// The result is unspecified when floating point ranges contain NaNs
+template<ArithmeticContiguousRange Range>
+std::ranges::range_value_t<Range> simdMin(const Range &range, SimdLevel level = supportedSimdLevel()) {
+    using T = std::ranges::range_value_t<Range>;
+    const T *elems = std::ranges::data(range);
+    const size_t count = std::ranges::size(range);
+
+    if (count == 0) {
+        throw std::out_of_range("Container is empty");
+    }
+
+    // Kernels start from a full register
+    if (count < 16) {
+        level = SimdLevel::Scalar;
+    }
+
+    VECTOR_SIMD_DISPATCH(min, ScalarKernels::min(elems, 1, count, elems[0]), elems, count)
+}
+
+template<ArithmeticContiguousRange Range>
+std::ranges::range_value_t<Range> simdMax(const Range &range, SimdLevel level = supportedSimdLevel()) {
+    using T = std::ranges::range_value_t<Range>;
+    const T *elems = std::ranges::data(range);
+    const size_t count = std::ranges::size(range);
+
+    if (count == 0) {
+        throw std::out_of_range("Container is empty");
+    }
+
+    if (count < 16) {
+        level = SimdLevel::Scalar;
+    }
+
+    VECTOR_SIMD_DISPATCH(max, ScalarKernels::max(elems, 1, count, elems[0]), elems, count)
+}
+
+// Floating point sums are added in a different order than the scalar loop, results may differ by rounding
+template<ArithmeticContiguousRange Range>
+SimdSumType<std::ranges::range_value_t<Range>> simdSum(const Range &range, SimdLevel level = supportedSimdLevel()) {
+    using T = std::ranges::range_value_t<Range>;
+    const T *elems = std::ranges::data(range);
+    const size_t count = std::ranges::size(range);
+
+    VECTOR_SIMD_DISPATCH(sum, ScalarKernels::sum(elems, 0, count), elems, count)
+}
+
+#undef VECTOR_SIMD_DISPATCH
+
+#endif //VECTOR_VECTORALGORITHMS_H
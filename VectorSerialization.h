@@ -0,0 +1,238 @@
+//
+// Created by Sebastian on 16.10.2026.
+//
+
+#ifndef VECTOR_VECTORSERIALIZATION_H
+#define VECTOR_VECTORSERIALIZATION_H
+
+#include "Vector.h"
+#include <istream>
+#include <ostream>
+
+// Binary layout of serialized Vectors: this 64 byte header followed by the raw element bytes at payloadOffset.
+// Readers reject data written for another element size, alignment, byte order or a newer version
+struct VectorFileHeader {
+    static constexpr uint64_t Magic = 0x4E42524F54434556; // "VECTORBN" read as little endian
+    static constexpr uint32_t CurrentVersion = 1;
+    // Written in the byte order of the producer
+    static constexpr uint32_t EndianMarker = 0x01020304;
+    static constexpr size_t PayloadOffset = 64;
+
+    uint64_t magic;
+    uint32_t version;
+    uint32_t endianMarker;
+    uint32_t elemSize;
+    uint32_t elemAlignment;
+    uint64_t elemCount;
+    uint64_t payloadOffset;
+    uint8_t reserved[24];
+
+    template<typename T>
+    static VectorFileHeader describe(size_t elemCount) {
+        return {Magic, CurrentVersion, EndianMarker, sizeof(T), alignof(T), elemCount, PayloadOffset, {}};
+    }
+
+    // availableBytes counts the header as well
+    template<typename T>
+    void validate(size_t availableBytes) const {
+        // The producer's byte order swaps the magic as well
+        if (magic == __builtin_bswap64(Magic) && endianMarker == __builtin_bswap32(EndianMarker)) {
+            throw std::runtime_error("Serialized vector has a different byte order");
+        }
+
+        if (magic != Magic || endianMarker != EndianMarker) {
+            throw std::runtime_error("Not a serialized vector");
+        }
+
+        // No writer produces version 0
+        if (version == 0) {
+            throw std::runtime_error("Serialized vector header is corrupt");
+        }
+
+        if (version > CurrentVersion) {
+            throw std::runtime_error("Serialized vector has an unsupported version");
+        }
+
+        if (elemSize != sizeof(T) || elemAlignment != alignof(T)) {
+            throw std::runtime_error("Serialized vector holds a different element type");
+        }
+
+        if (payloadOffset < sizeof(VectorFileHeader) || payloadOffset % alignof(T) != 0) {
+            throw std::runtime_error("Serialized vector header is corrupt");
+        }
+
+        if (payloadOffset > availableBytes || elemCount > (availableBytes - payloadOffset) / sizeof(T)) {
+            throw std::runtime_error("Serialized vector is truncated");
+        }
+    }
+};
+
+static_assert(sizeof(VectorFileHeader) == VectorFileHeader::PayloadOffset);
+
+template<typename Range>
+concept SerializableRange = std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range> &&
+                            std::is_trivially_copyable_v<std::ranges::range_value_t<Range>> &&
+                            alignof(std::ranges::range_value_t<Range>) <= VectorFileHeader::PayloadOffset;
+
+template<typename T>
+constexpr size_t serializedBytes(size_t elemCount) {
+    return VectorFileHeader::PayloadOffset + elemCount * sizeof(T);
+}
+
+// Header and payload, the elements go out in one write
+template<SerializableRange Range>
+void writeVector(std::ostream &out, const Range &range) {
+    using T = std::ranges::range_value_t<Range>;
+    const size_t elemCount = std::ranges::size(range);
+    const VectorFileHeader header = VectorFileHeader::describe<T>(elemCount);
+
+    out.write((const char *) &header, sizeof(header));
+    out.write((const char *) std::ranges::data(range), (std::streamsize) (elemCount * sizeof(T)));
+
+    if (!out) {
+        throw std::runtime_error("Writing serialized vector failed");
+    }
+}
+
+// Replaces the contents of vector. A stream doesn't tell how much follows and a forged count must not
+// commit memory up front, so the payload is read straight into the buffer in bounded chunks
+template<typename T, typename... Params>
+void readVector(std::istream &in, Vector<T, Params...> &vector) {
+    static_assert(std::is_trivially_copyable_v<T>, "Serialized elements are stored as raw bytes");
+
+    constexpr size_t ChunkElems = std::max<size_t>(1, (size_t{1} << 20) / sizeof(T));
+    VectorFileHeader header{};
+
+    if (!in.read((char *) &header, sizeof(header))) {
+        throw std::runtime_error("Serialized vector is truncated");
+    }
+
+    header.validate<T>(std::numeric_limits<size_t>::max());
+    const auto paddingBytes = (std::streamsize) (header.payloadOffset - sizeof(header));
+
+    if (in.ignore(paddingBytes).gcount() != paddingBytes) {
+        throw std::runtime_error("Serialized vector is truncated");
+    }
+
+    vector.clear();
+    vector.reserve(std::min<size_t>(header.elemCount, ChunkElems));
+
+    for (size_t remaining = header.elemCount; remaining > 0;) {
+        const size_t chunk = std::min(remaining, ChunkElems);
+        const size_t oldCount = vector.size();
+        vector.resize_for_overwrite(oldCount + chunk);
+
+        if (!in.read((char *) (vector.data() + oldCount), (std::streamsize) (chunk * sizeof(T)))) {
+            vector.clear();
+            throw std::runtime_error("Serialized vector is truncated");
+        }
+
+        remaining -= chunk;
+    }
+}
+
+template<typename T>
+Vector<T> readVector(std::istream &in) {
+    Vector<T> vector;
+    readVector(in, vector);
+
+    return vector;
+}
+
+// Read only view of a serialized vector in memory, for example a mapped file. Nothing gets copied,
+// the region has to outlive the view
+template<typename T>
+class VectorView {
+    static_assert(std::is_trivially_copyable_v<T>, "Serialized elements are stored as raw bytes");
+
+    const T *m_data{};
+    size_t m_elemCount{};
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = const T &;
+    using const_reference = const T &;
+    using iterator = const T *;
+    using const_iterator = const T *;
+
+    VectorView() = default;
+
+    explicit VectorView(std::span<const std::byte> region) {
+        if (region.size() < sizeof(VectorFileHeader)) {
+            throw std::runtime_error("Serialized vector is truncated");
+        }
+
+        // The region itself may not be aligned for the header
+        VectorFileHeader header{};
+        std::memcpy(&header, region.data(), sizeof(header));
+        header.validate<T>(region.size());
+
+        const std::byte *payload = region.data() + header.payloadOffset;
+
+        if ((uintptr_t) payload % alignof(T) != 0) {
+            throw std::runtime_error("Serialized vector payload is misaligned");
+        }
+
+        m_data = (const T *) payload;
+        m_elemCount = header.elemCount;
+    }
+
+    // Element access
+    const T &at(size_t index) const {
+        if (index >= m_elemCount) {
+            throw std::out_of_range("Out of range");
+        }
+
+        return m_data[index];
+    }
+
+    const T &operator[](size_t index) const {
+        return m_data[index];
+    }
+
+    const T &front() const {
+        return at(0);
+    }
+
+    const T &back() const {
+        if (m_elemCount == 0) {
+            throw std::out_of_range("Container is empty");
+        }
+
+        return m_data[m_elemCount - 1];
+    }
+
+    const T *data() const {
+        return m_data;
+    }
+
+    // Capacity
+    bool empty() const {
+        return m_elemCount == 0;
+    }
+
+    size_t size() const {
+        return m_elemCount;
+    }
+
+    // Iterators
+    const T *begin() const {
+        return m_data;
+    }
+
+    const T *end() const {
+        return m_data + m_elemCount;
+    }
+
+    const T *cbegin() const {
+        return begin();
+    }
+
+    const T *cend() const {
+        return end();
+    }
+};
+
+#endif //VECTOR_VECTORSERIALIZATION_H
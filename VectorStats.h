@@ -0,0 +1,113 @@
+//
+// Created by Sebastian on 16.10.2026.
+//
+
+#ifndef VECTOR_VECTORSTATS_H
+#define VECTOR_VECTORSTATS_H
+
+#include "Vector.h"
+#include <atomic>
+
+struct VectorStatsCounters {
+    size_t allocations{};
+    size_t deallocations{};
+    size_t allocatedBytes{};
+    // Buffer replaced by a new one, existing elements carried over
+    size_t relocations{};
+    size_t relocatedBytes{};
+    // Elements moved by growth, inserts and erases
+    size_t elemsMoved{};
+    size_t peakCapacityBytes{};
+};
+
+// Statistics policy recording per instance counters and process wide aggregates of all Vectors using it.
+// Opt in with Vector<T, Alloc, Growth, VectorStats>, the default NoVectorStats costs nothing
+class VectorStats {
+private:
+    // std::atomic value initializes since C++20
+    struct AtomicCounters {
+        std::atomic<size_t> allocations;
+        std::atomic<size_t> deallocations;
+        std::atomic<size_t> allocatedBytes;
+        std::atomic<size_t> relocations;
+        std::atomic<size_t> relocatedBytes;
+        std::atomic<size_t> elemsMoved;
+        std::atomic<size_t> peakCapacityBytes;
+    };
+
+    inline static AtomicCounters s_totals;
+    VectorStatsCounters m_counters;
+
+    static void add(std::atomic<size_t> &counter, size_t value) {
+        counter.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    static void updatePeak(std::atomic<size_t> &peak, size_t value) {
+        size_t current = peak.load(std::memory_order_relaxed);
+
+        while (current < value && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+
+public:
+    void onAllocation(size_t bytes) {
+        m_counters.allocations++;
+        m_counters.allocatedBytes += bytes;
+        add(s_totals.allocations, 1);
+        add(s_totals.allocatedBytes, bytes);
+    }
+
+    void onDeallocation(size_t) {
+        m_counters.deallocations++;
+        add(s_totals.deallocations, 1);
+    }
+
+    void onRelocation(size_t bytes) {
+        m_counters.relocations++;
+        m_counters.relocatedBytes += bytes;
+        add(s_totals.relocations, 1);
+        add(s_totals.relocatedBytes, bytes);
+    }
+
+    void onElemsMoved(size_t elemCount) {
+        m_counters.elemsMoved += elemCount;
+        add(s_totals.elemsMoved, elemCount);
+    }
+
+    void onCapacity(size_t bytes) {
+        m_counters.peakCapacityBytes = std::max(m_counters.peakCapacityBytes, bytes);
+        updatePeak(s_totals.peakCapacityBytes, bytes);
+    }
+
+    [[nodiscard]] const VectorStatsCounters &counters() const {
+        return m_counters;
+    }
+
+    // Snapshot of the aggregates, the single counters are consistent on their own only
+    static VectorStatsCounters totals() {
+        return {
+                s_totals.allocations.load(std::memory_order_relaxed),
+                s_totals.deallocations.load(std::memory_order_relaxed),
+                s_totals.allocatedBytes.load(std::memory_order_relaxed),
+                s_totals.relocations.load(std::memory_order_relaxed),
+                s_totals.relocatedBytes.load(std::memory_order_relaxed),
+                s_totals.elemsMoved.load(std::memory_order_relaxed),
+                s_totals.peakCapacityBytes.load(std::memory_order_relaxed)
+        };
+    }
+
+    static void resetTotals() {
+        s_totals.allocations.store(0, std::memory_order_relaxed);
+        s_totals.deallocations.store(0, std::memory_order_relaxed);
+        s_totals.allocatedBytes.store(0, std::memory_order_relaxed);
+        s_totals.relocations.store(0, std::memory_order_relaxed);
+        s_totals.relocatedBytes.store(0, std::memory_order_relaxed);
+        s_totals.elemsMoved.store(0, std::memory_order_relaxed);
+        s_totals.peakCapacityBytes.store(0, std::memory_order_relaxed);
+    }
+};
+
+template<typename T, typename Alloc = MallocAllocator<T>, GrowthPolicy Growth = GrowthFactor<3, 2>>
+using StatsVector = Vector<T, Alloc, Growth, VectorStats>;
+
+#endif //VECTOR_VECTORSTATS_H
@@ -0,0 +1,131 @@
+//
+// Created by Sebastian on 16.10.2026.
+//
+
+#ifndef VECTOR_VIRTUALMEMORYALLOCATOR_H
+#define VECTOR_VIRTUALMEMORYALLOCATOR_H
+
+#include "Vector.h"
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Reserves a large address range up front (PROT_NONE, no backing memory) and commits pages as the
+// buffer grows. Vector resizes such buffers in place, elements never get relocated and pointers stay valid
+// until the reservation ceiling is hit. Buffers larger than the ceiling get their own reservation.
+template<typename T>
+class VirtualMemoryAllocator {
+private:
+    size_t m_reserveBytes;
+    size_t m_commitBytes;
+
+    static size_t roundUp(size_t bytes, size_t granularity) {
+        return (bytes + granularity - 1) / granularity * granularity;
+    }
+
+    [[nodiscard]] size_t committedBytes(size_t elemCount) const {
+        return roundUp(elemCount * sizeof(T), m_commitBytes);
+    }
+
+    // Derived from the capacity alone, deallocate has to unmap the same range allocate mapped
+    [[nodiscard]] size_t reservationSize(size_t elemCount) const {
+        return std::max(m_reserveBytes, committedBytes(elemCount));
+    }
+
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    static constexpr size_t defaultReserveBytes = size_t{1} << 34; // 16 GiB
+    static constexpr size_t defaultCommitBytes = size_t{1} << 16; // 64 KiB
+
+    explicit VirtualMemoryAllocator(size_t reserveBytes = defaultReserveBytes,
+                                    size_t commitBytes = defaultCommitBytes) {
+        const auto pageSize = (size_t) sysconf(_SC_PAGESIZE);
+
+        // At least one element per commit step keeps the capacity to committed bytes mapping unambiguous
+        m_commitBytes = roundUp(std::max(commitBytes, sizeof(T)), pageSize);
+        m_reserveBytes = roundUp(reserveBytes, m_commitBytes);
+    }
+
+    template<typename U>
+    VirtualMemoryAllocator(const VirtualMemoryAllocator<U> &other)
+            : VirtualMemoryAllocator(other.reserveBytes(), other.commitBytes()) {}
+
+    AllocationResult<T *> allocate_at_least(size_t elemCount) {
+        if (elemCount > std::numeric_limits<size_t>::max() / 2 / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+
+        const size_t reservation = reservationSize(elemCount);
+        void *mem = mmap(nullptr, reservation, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+        if (mem == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+
+        const size_t committed = committedBytes(elemCount);
+
+        if (mprotect(mem, committed, PROT_READ | PROT_WRITE) != 0) {
+            munmap(mem, reservation);
+            throw std::bad_alloc();
+        }
+
+        return {static_cast<T *>(mem), committed / sizeof(T)};
+    }
+
+    T *allocate(size_t elemCount) {
+        return allocate_at_least(elemCount).ptr;
+    }
+
+    void deallocate(T *ptr, size_t elemCount) noexcept {
+        munmap(ptr, reservationSize(elemCount));
+    }
+
+    // Commits or decommits the pages behind the buffer, the address never changes
+    size_t resizeInPlace(T *ptr, size_t elemCount, size_t newElemCount) {
+        if (newElemCount > std::numeric_limits<size_t>::max() / 2 / sizeof(T) ||
+            reservationSize(newElemCount) != reservationSize(elemCount)) {
+            return 0;
+        }
+
+        auto *buffer = (uint8_t *) ptr;
+        const size_t committed = committedBytes(elemCount);
+        const size_t newCommitted = committedBytes(newElemCount);
+
+        if (newCommitted > committed) {
+            if (mprotect(buffer + committed, newCommitted - committed, PROT_READ | PROT_WRITE) != 0) {
+                throw std::bad_alloc();
+            }
+        } else if (newCommitted < committed) {
+            // Give the memory back, the address range stays reserved
+            madvise(buffer + newCommitted, committed - newCommitted, MADV_DONTNEED);
+            mprotect(buffer + newCommitted, committed - newCommitted, PROT_NONE);
+        }
+
+        return newCommitted / sizeof(T);
+    }
+
+    [[nodiscard]] size_t reserveBytes() const {
+        return m_reserveBytes;
+    }
+
+    [[nodiscard]] size_t commitBytes() const {
+        return m_commitBytes;
+    }
+
+    friend bool operator==(const VirtualMemoryAllocator &lhs, const VirtualMemoryAllocator &rhs) {
+        return lhs.m_reserveBytes == rhs.m_reserveBytes && lhs.m_commitBytes == rhs.m_commitBytes;
+    }
+
+    friend bool operator!=(const VirtualMemoryAllocator &lhs, const VirtualMemoryAllocator &rhs) {
+        return !(lhs == rhs);
+    }
+};
+
+// Vector which reserves its address range up front and never relocates its elements while growing
+template<typename T, GrowthPolicy Growth = GrowthFactor<3, 2>>
+using ReservedVector = Vector<T, VirtualMemoryAllocator<T>, Growth>;
+
+#endif //VECTOR_VIRTUALMEMORYALLOCATOR_H
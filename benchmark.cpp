@@ -0,0 +1,231 @@
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Vector.h"
+
+// Counts the allocations of the wrapped allocator, including the realloc extension Vector uses
+struct AllocationCounter {
+    inline static size_t allocations = 0;
+};
+
+template<typename T, typename Base>
+struct CountingAllocator : Base {
+    using value_type = T;
+
+    template<typename U>
+    struct rebind {
+        using other = CountingAllocator<U, typename std::allocator_traits<Base>::template rebind_alloc<U>>;
+    };
+
+    CountingAllocator() = default;
+
+    template<typename U, typename OtherBase>
+    CountingAllocator(const CountingAllocator<U, OtherBase> &) noexcept {}
+
+    T *allocate(size_t elemCount) {
+        AllocationCounter::allocations++;
+        return Base::allocate(elemCount);
+    }
+
+    T *reallocate(T *ptr, size_t elemCount, size_t newElemCount) requires HasReallocate<Base>::value {
+        AllocationCounter::allocations++;
+        return Base::reallocate(ptr, elemCount, newElemCount);
+    }
+};
+
+template<typename T>
+using BenchVector = Vector<T, CountingAllocator<T, MallocAllocator<T>>>;
+
+template<typename T>
+using BenchStdVector = std::vector<T, CountingAllocator<T, std::allocator<T>>>;
+
+struct Payload64 {
+    uint64_t values[8];
+};
+
+template<typename T>
+T makeValue(size_t i) {
+    if constexpr (std::is_same_v<T, int>) {
+        return (int) i;
+    } else if constexpr (std::is_same_v<T, Payload64>) {
+        return Payload64{{i, i, i, i, i, i, i, i}};
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        // Longer than the small string buffer
+        return "benchmark string number " + std::to_string(i);
+    } else {
+        return std::make_unique<size_t>(i);
+    }
+}
+
+template<typename T>
+size_t checksum(const T &value) {
+    if constexpr (std::is_same_v<T, int>) {
+        return value;
+    } else if constexpr (std::is_same_v<T, Payload64>) {
+        return value.values[7];
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        return value.size();
+    } else {
+        return *value;
+    }
+}
+
+// Keeps the compiler from optimizing the measured work away
+volatile size_t sink;
+
+struct Measurement {
+    double nsPerOp;
+    size_t allocations;
+};
+
+// Best of several runs, setup returns the container the timed body works on
+template<typename Setup, typename Body>
+Measurement measure(size_t opCount, Setup setup, Body body) {
+    constexpr int runs = 5;
+    Measurement best{1e300, 0};
+
+    for (int run = 0; run < runs; run++) {
+        auto container = setup();
+        AllocationCounter::allocations = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        body(container);
+        auto stop = std::chrono::steady_clock::now();
+
+        const double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+
+        if (ns / opCount < best.nsPerOp) {
+            best = {ns / opCount, AllocationCounter::allocations};
+        }
+    }
+
+    return best;
+}
+
+void printRow(const char *operation, const char *type, Measurement vector, Measurement stdVector) {
+    std::printf("%-14s %-12s %12.2f %12.2f %10zu %10zu\n", operation, type, vector.nsPerOp, stdVector.nsPerOp,
+                vector.allocations, stdVector.allocations);
+}
+
+template<typename Container>
+Container filled(size_t count) {
+    Container container;
+
+    for (size_t i = 0; i < count; i++) {
+        container.push_back(makeValue<typename Container::value_type>(i));
+    }
+
+    return container;
+}
+
+template<typename Container>
+Measurement benchPushBack(size_t count) {
+    return measure(count, [] { return Container{}; }, [count](Container &container) {
+        for (size_t i = 0; i < count; i++) {
+            container.push_back(makeValue<typename Container::value_type>(i));
+        }
+    });
+}
+
+// position: 0 = front, 1 = middle, 2 = back
+template<typename Container>
+Measurement benchInsert(size_t count, int position) {
+    return measure(count, [] { return Container{}; }, [count, position](Container &container) {
+        for (size_t i = 0; i < count; i++) {
+            const size_t offset = position == 0 ? 0 : position == 1 ? container.size() / 2 : container.size();
+            auto iter = container.begin();
+            iter += offset;
+            container.insert(iter, makeValue<typename Container::value_type>(i));
+        }
+    });
+}
+
+template<typename Container>
+Measurement benchErase(size_t count) {
+    return measure(count, [count] { return filled<Container>(count); }, [](Container &container) {
+        while (!container.empty()) {
+            auto iter = container.begin();
+            iter += container.size() / 2;
+            container.erase(iter);
+        }
+    });
+}
+
+template<typename Container>
+Measurement benchCopy(size_t count) {
+    return measure(count, [count] { return filled<Container>(count); }, [](Container &container) {
+        Container copy = container;
+        sink = checksum(copy[copy.size() - 1]);
+    });
+}
+
+template<typename Container>
+Measurement benchMove(size_t count) {
+    // Moves back and forth, so the elements get destroyed outside the timed body
+    return measure(2, [count] { return filled<Container>(count); }, [](Container &container) {
+        Container moved = std::move(container);
+        sink = moved.size();
+        container = std::move(moved);
+    });
+}
+
+template<typename Container>
+Measurement benchIterate(size_t count) {
+    return measure(count, [count] { return filled<Container>(count); }, [](Container &container) {
+        size_t sum = 0;
+
+        for (const auto &value: container) {
+            sum += checksum(value);
+        }
+
+        sink = sum;
+    });
+}
+
+template<typename Container>
+Measurement benchShrinkToFit(size_t count) {
+    return measure(count, [count] {
+        Container container = filled<Container>(count);
+        container.reserve(count * 2);
+        return container;
+    }, [](Container &container) {
+        container.shrink_to_fit();
+    });
+}
+
+template<typename T>
+void benchType(const char *typeName) {
+    constexpr size_t count = 1 << 16;
+    constexpr size_t insertCount = 1 << 13;
+
+    printRow("push_back", typeName, benchPushBack<BenchVector<T>>(count), benchPushBack<BenchStdVector<T>>(count));
+    printRow("insert front", typeName, benchInsert<BenchVector<T>>(insertCount, 0),
+             benchInsert<BenchStdVector<T>>(insertCount, 0));
+    printRow("insert middle", typeName, benchInsert<BenchVector<T>>(insertCount, 1),
+             benchInsert<BenchStdVector<T>>(insertCount, 1));
+    printRow("insert back", typeName, benchInsert<BenchVector<T>>(count, 2),
+             benchInsert<BenchStdVector<T>>(count, 2));
+    printRow("erase middle", typeName, benchErase<BenchVector<T>>(insertCount),
+             benchErase<BenchStdVector<T>>(insertCount));
+
+    if constexpr (std::is_copy_constructible_v<T>) {
+        printRow("copy ctor", typeName, benchCopy<BenchVector<T>>(count), benchCopy<BenchStdVector<T>>(count));
+    }
+
+    printRow("move ctor", typeName, benchMove<BenchVector<T>>(count), benchMove<BenchStdVector<T>>(count));
+    printRow("iterate", typeName, benchIterate<BenchVector<T>>(count), benchIterate<BenchStdVector<T>>(count));
+    printRow("shrink_to_fit", typeName, benchShrinkToFit<BenchVector<T>>(count),
+             benchShrinkToFit<BenchStdVector<T>>(count));
+}
+
+int main() {
+    std::printf("%-14s %-12s %12s %12s %10s %10s\n", "operation", "type", "Vector ns", "std ns", "Vector al",
+                "std al");
+
+    benchType<int>("4B");
+    benchType<Payload64>("64B");
+    benchType<std::string>("std::string");
+    benchType<std::unique_ptr<size_t>>("move-only");
+}
@@ -1,12 +1,32 @@
 #include <iostream>
 #include "Vector.h"
+#include "SmallVector.h"
+#include "VirtualMemoryAllocator.h"
+#include "HugePageAllocator.h"
+#include "VectorStats.h"
+#include "VectorAlgorithms.h"
+#include "SoaVector.h"
+#include "StableVector.h"
+#include "CowVector.h"
+#include "PersistentVector.h"
+#include "ConcurrentVector.h"
+#include "RcuVector.h"
+#include "MappedVector.h"
+#include "VectorSerialization.h"
+#include <filesystem>
+#include <thread>
 #include <vector>
 #include <sstream>
+#include <fstream>
+#include <algorithm>
+#include <forward_list>
+#include <list>
+#include <ranges>
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "doctest.h"
 
-template <typename T>
-T readVectorValues(Vector<T>& vec) {
+template <typename T, typename... Params>
+T readVectorValues(Vector<T, Params...>& vec) {
     T res{};
 
     for (const T& val: vec) {
@@ -189,6 +209,32 @@ TEST_CASE("Iterator") {
 
         REQUIRE(*iter == "Strings");
     }
+
+    SUBCASE("Random access") {
+        static_assert(std::contiguous_iterator<Vector<std::string>::iterator>);
+        static_assert(std::contiguous_iterator<Vector<std::string>::const_iterator>);
+        static_assert(std::ranges::contiguous_range<Vector<int>>);
+        static_assert(std::ranges::contiguous_range<const Vector<int>>);
+
+        auto iter = v.begin() + 4;
+        Vector<std::string>::const_iterator constIter = iter;
+        bool check = iter[1] == "Here" && iter - v.begin() == 4 && v.begin() < iter && constIter == iter - 0 &&
+                     std::distance(v.begin(), v.end()) == 6;
+        REQUIRE(check);
+    }
+
+    SUBCASE("Algorithms") {
+        std::sort(v.begin(), v.end());
+        REQUIRE(std::is_sorted(v.begin(), v.end()));
+
+        auto found = std::lower_bound(v.begin(), v.end(), "Multiple");
+        REQUIRE(*found == "Multiple");
+
+        Vector<int> ints{5, 3, 9, 1};
+        std::ranges::sort(ints);
+        bool check = ints[0] == 1 && ints[3] == 9 && std::ranges::binary_search(ints, 5);
+        REQUIRE(check);
+    }
 }
 
 TEST_CASE("Ranged loops") {
@@ -208,4 +254,1572 @@ TEST_CASE("Ranged loops") {
     }
 
     REQUIRE(ss.str() == ss2.str());
-}
\ No newline at end of file
+}
+
+struct Tick {
+    uint64_t timestamp;
+    double price;
+    int32_t volume;
+};
+
+TEST_CASE("Trivially relocatable elements") {
+    static_assert(IsTriviallyRelocatable<Tick>::value);
+    static_assert(!IsTriviallyRelocatable<std::string>::value);
+
+    Vector<Tick> v;
+
+    for (int i = 0; i < 100; i++) {
+        v.push_back(Tick{(uint64_t) i, i * 0.5, i});
+    }
+
+    SUBCASE("Growth") {
+        bool check = v.size() == 100 && v[0].volume == 0 && v[99].timestamp == 99 && v[50].price == 25.0;
+        REQUIRE(check);
+    }
+
+    SUBCASE("Shrink") {
+        v.shrink_to_fit();
+        bool check = v.capacity() == 100 && v[99].volume == 99;
+        REQUIRE(check);
+    }
+
+    SUBCASE("Insert/Erase") {
+        v.shrink_to_fit();
+        auto iter = v.begin();
+        iter += 10;
+
+        v.insert(iter, Tick{1000, 0.0, -1}); // Reallocating insert
+        bool check = v[10].volume == -1 && v[11].volume == 10 && v[100].volume == 99;
+        REQUIRE(check);
+
+        iter = v.begin();
+        iter += 20;
+        v.insert(iter, 2, Tick{2000, 0.0, -2}); // Shifting insert
+        check = v[20].volume == -2 && v[21].volume == -2 && v[22].volume == 19 && v.size() == 103;
+        REQUIRE(check);
+
+        v.erase(v.begin());
+        check = v[0].volume == 1 && v[9].volume == -1 && v.size() == 102;
+        REQUIRE(check);
+    }
+    SUBCASE("Reallocation") {
+        // Large enough to be served by mmap and grown by mremap
+        Vector<uint64_t> large;
+
+        for (uint64_t i = 0; i < (1 << 20); i++) {
+            large.push_back(i);
+        }
+
+        bool check = large[0] == 0 && large[12345] == 12345 && large[(1 << 20) - 1] == (1 << 20) - 1;
+        REQUIRE(check);
+
+        large.clear();
+        large.shrink_to_fit();
+        check = large.capacity() == 0 && large.empty();
+        REQUIRE(check);
+
+        large.push_back(42);
+        REQUIRE(large[0] == 42);
+    }
+}
+
+TEST_CASE("Allocators") {
+    SUBCASE("std::allocator") {
+        Vector<int, std::allocator<int>> v{1, 2, 3};
+        v.push_back(4);
+        v.shrink_to_fit();
+
+        Vector<int, std::allocator<int>> v2 = v;
+        bool check = v2.size() == 4 && v2[3] == 4 && readVectorValues(v2) == 10;
+        REQUIRE(check);
+    }
+
+    SUBCASE("pmr") {
+        std::pmr::monotonic_buffer_resource arena;
+        PmrVector<std::string> v{&arena};
+
+        for (int i = 0; i < 20; i++) {
+            v.push_back(std::to_string(i));
+        }
+
+        REQUIRE(v.get_allocator().resource() == &arena);
+
+        // Copies don't inherit the resource
+        PmrVector<std::string> copy = v;
+        REQUIRE(copy.get_allocator().resource() == std::pmr::get_default_resource());
+        REQUIRE(copy[19] == "19");
+
+        // Move assignment between different resources moves the elements, the resource stays
+        copy = std::move(v);
+        bool check = copy.get_allocator().resource() == std::pmr::get_default_resource() &&
+                     copy.size() == 20 && copy[5] == "5" && v.empty();
+        REQUIRE(check);
+
+        // Same resource, the buffer changes owner
+        PmrVector<std::string> v2{&arena};
+        v2 = PmrVector<std::string>({"One", "Two"}, &arena);
+        REQUIRE(v2[1] == "Two");
+    }
+
+    SUBCASE("Swap") {
+        Vector<std::string> v{"One", "Two"};
+        Vector<std::string> v2{"Three"};
+        swap(v, v2);
+
+        bool check = v.size() == 1 && v[0] == "Three" && v2.size() == 2 && v2[1] == "Two";
+        REQUIRE(check);
+    }
+}
+
+TEST_CASE("Small vector") {
+    SmallVector<std::string, 4> v;
+
+    // Checks if the elements live inside the object
+    auto isInline = [](const auto &vec) {
+        auto *objStart = (const uint8_t *) &vec;
+        auto *dataStart = (const uint8_t *) vec.data();
+        return dataStart >= objStart && dataStart < objStart + sizeof(vec);
+    };
+
+    v.push_back("One");
+    v.push_back("Two");
+
+    SUBCASE("Inline") {
+        bool check = isInline(v) && v.capacity() == 4 && v[1] == "Two";
+        REQUIRE(check);
+    }
+
+    SUBCASE("Spill/Shrink") {
+        v.insert(v.begin(), 3, "s");
+        bool check = !isInline(v) && v.size() == 5 && v[0] == "s" && v[4] == "Two";
+        REQUIRE(check);
+
+        auto first = v.begin();
+        auto last = v.begin();
+        last += 3;
+        v.erase(first, last);
+        v.shrink_to_fit();
+        check = isInline(v) && v.size() == 2 && v[0] == "One" && v[1] == "Two";
+        REQUIRE(check);
+    }
+
+    SUBCASE("Copy/Move") {
+        SmallVector<std::string, 4> copy = v;
+        bool check = isInline(copy) && copy.data() != v.data() && copy[0] == "One";
+        REQUIRE(check);
+
+        SmallVector<std::string, 4> moved = std::move(copy);
+        check = isInline(moved) && moved.size() == 2 && copy.empty() && moved[1] == "Two";
+        REQUIRE(check);
+
+        SmallVector<std::string, 4> large{"1", "2", "3", "4", "5", "6"};
+        const std::string *heapData = large.data();
+        moved = std::move(large);
+        check = moved.data() == heapData && moved.size() == 6 && large.empty();
+        REQUIRE(check);
+
+        swap(moved, v);
+        check = v.size() == 6 && v.data() == heapData && isInline(moved) && moved[0] == "One";
+        REQUIRE(check);
+    }
+}
+
+TEST_CASE("Growth policies") {
+    static_assert(GrowthPolicy<GrowthFactor<2>>);
+    static_assert(!GrowthPolicy<int>);
+    static_assert(GrowthFactor<3, 2>::nextCapacity(10, 11, 4) == 15);
+    static_assert(GrowthFactor<2>::nextCapacity(0, 1, 4) == 1);
+    static_assert(FixedStepGrowth<64>::nextCapacity(64, 65, 4) == 128);
+    static_assert(SizeClassGrowth<>::roundToSizeClass(100) == 112);
+    static_assert(SizeClassGrowth<GrowthFactor<2>>::nextCapacity(10, 11, 4) == 20);
+    static_assert(SizeClassGrowth<GrowthFactor<2>>::nextCapacity(13, 14, 4) == 28);
+
+    SUBCASE("Factor 2") {
+        Vector<int, MallocAllocator<int>, GrowthFactor<2>> v;
+
+        for (int i = 0; i < 5; i++) {
+            v.push_back(i);
+        }
+
+        REQUIRE(v.capacity() == 8);
+    }
+
+    SUBCASE("Fixed step") {
+        Vector<std::string, MallocAllocator<std::string>, FixedStepGrowth<10>> v;
+        v.push_back("One");
+        REQUIRE(v.capacity() == 10);
+
+        v.insert(v.begin(), 10, "s");
+        bool check = v.capacity() == 20 && v.size() == 11 && v[10] == "One";
+        REQUIRE(check);
+    }
+
+    SUBCASE("Size classes") {
+        Vector<uint8_t, MallocAllocator<uint8_t>, SizeClassGrowth<>> v;
+        v.push_back(1);
+        REQUIRE(v.capacity() == 16);
+
+        for (uint8_t i = 0; i < 100; i++) {
+            v.push_back(i);
+        }
+
+        REQUIRE(v.capacity() == SizeClassGrowth<>::roundToSizeClass(v.capacity()));
+    }
+}
+
+TEST_CASE("Reserved address space") {
+    ReservedVector<uint64_t> v{VirtualMemoryAllocator<uint64_t>{size_t{1} << 30}};
+    v.push_back(0);
+    const uint64_t *start = v.data();
+
+    SUBCASE("Growth without relocation") {
+        for (uint64_t i = 1; i < 1000000; i++) {
+            v.push_back(i);
+        }
+
+        v.insert(v.begin(), 5, 42);
+        bool check = v.data() == start && v.size() == 1000005 && v[4] == 42 && v[5] == 0 && v[1000004] == 999999;
+        REQUIRE(check);
+
+        v.shrink_to_fit();
+        check = v.data() == start && v.capacity() >= v.size() && v[1000004] == 999999;
+        REQUIRE(check);
+    }
+
+    SUBCASE("Reservation exceeded") {
+        ReservedVector<std::string> small{VirtualMemoryAllocator<std::string>{1 << 16, 1 << 12}};
+        small.push_back("First");
+        const std::string *smallStart = small.data();
+
+        for (int i = 0; i < 5000; i++) {
+            small.push_back(std::to_string(i));
+        }
+
+        bool check = small.data() != smallStart && small[0] == "First" && small[5000] == "4999";
+        REQUIRE(check);
+
+        // Copies keep the configuration
+        ReservedVector<std::string> copy = small;
+        check = copy.get_allocator() == small.get_allocator() && copy[1] == "0";
+        REQUIRE(check);
+    }
+}
+
+TEST_CASE("Huge pages") {
+    HugePageVector<uint64_t> v{1, 2, 3};
+
+    auto isHugePageAligned = [](const void *ptr) {
+        return (uintptr_t) ptr % HugePageAllocator<uint64_t>::hugePageSize == 0;
+    };
+
+    SUBCASE("Small buffers") {
+        v.shrink_to_fit();
+        bool check = v.capacity() == 3 && v[2] == 3;
+        REQUIRE(check);
+    }
+
+    SUBCASE("Large buffers") {
+        for (uint64_t i = 0; i < 1000000; i++) {
+            v.push_back(i);
+        }
+
+        bool check = isHugePageAligned(v.data()) && v[0] == 1 && v[1000002] == 999999;
+        REQUIRE(check);
+
+        // Capacity is rounded to whole huge pages
+        v.shrink_to_fit();
+        check = isHugePageAligned(v.data()) && v.capacity() * sizeof(uint64_t) % (1 << 21) == 0;
+        REQUIRE(check);
+
+        v.reserve(1 << 22);
+        check = isHugePageAligned(v.data()) && v.capacity() >= (1 << 22) && v[1000002] == 999999;
+        REQUIRE(check);
+    }
+}
+
+struct alignas(64) CacheLine {
+    float values[16];
+};
+
+TEST_CASE("Alignment") {
+    auto isAligned = [](const void *ptr, size_t alignment) {
+        return (uintptr_t) ptr % alignment == 0;
+    };
+
+    SUBCASE("Over-aligned elements") {
+        Vector<CacheLine> v;
+
+        for (int i = 0; i < 100; i++) {
+            v.push_back(CacheLine{{(float) i}});
+        }
+
+        bool check = isAligned(v.data(), 64) && v[99].values[0] == 99.0f;
+        REQUIRE(check);
+
+        v.shrink_to_fit();
+        Vector<CacheLine> copy = v;
+        check = isAligned(v.data(), 64) && isAligned(copy.data(), 64) && copy[50].values[0] == 50.0f;
+        REQUIRE(check);
+    }
+
+    SUBCASE("Configured alignment") {
+        AlignedVector<float, 64> v;
+        bool alignedOnGrowth = true;
+
+        for (int i = 0; i < 1000; i++) {
+            v.push_back((float) i);
+            alignedOnGrowth = alignedOnGrowth && isAligned(v.data(), 64);
+        }
+
+        REQUIRE(alignedOnGrowth);
+
+        v.shrink_to_fit();
+        v.insert(v.begin(), 1.5f);
+        bool check = isAligned(v.data(), 64) && v[0] == 1.5f && v[1000] == 999.0f;
+        REQUIRE(check);
+
+        AlignedVector<std::string, 4096> pages{"One", "Two"};
+        pages.insert(pages.begin(), 10, "s");
+        AlignedVector<std::string, 4096> copy = pages;
+        check = isAligned(pages.data(), 4096) && isAligned(copy.data(), 4096) && copy[11] == "Two";
+        REQUIRE(check);
+    }
+}
+
+struct Heavy {
+    inline static int constructions = 0;
+    std::string name;
+    int id;
+
+    Heavy(std::string name, int id) : name{std::move(name)}, id{id} {
+        constructions++;
+    }
+
+    Heavy(const Heavy &other) : name{other.name}, id{other.id} {
+        constructions++;
+    }
+
+    Heavy(Heavy &&other) noexcept: name{std::move(other.name)}, id{other.id} {}
+
+    Heavy &operator=(const Heavy &) = default;
+
+    Heavy &operator=(Heavy &&) noexcept = default;
+};
+
+TEST_CASE("Emplace") {
+    Vector<Heavy> v;
+    Heavy::constructions = 0;
+
+    SUBCASE("emplace_back") {
+        Heavy &first = v.emplace_back("First", 1);
+        bool check = first.name == "First" && &first == v.data();
+        REQUIRE(check);
+
+        for (int i = 0; i < 10; i++) {
+            v.emplace_back("Elem", i);
+        }
+
+        // Constructed in place only, never copied
+        check = Heavy::constructions == 11 && v.size() == 11 && v[10].id == 9;
+        REQUIRE(check);
+    }
+
+    SUBCASE("emplace") {
+        v.emplace_back("One", 1);
+        v.emplace_back("Three", 3);
+
+        auto iter = v.begin();
+        iter++;
+        auto inserted = v.emplace(iter, "Two", 2);
+        bool check = inserted->name == "Two" && v[2].name == "Three" && Heavy::constructions == 3;
+        REQUIRE(check);
+
+        v.reserve(10);
+        v.emplace(v.begin(), "Zero", 0);
+        check = v[0].id == 0 && v[3].id == 3 && v.size() == 4;
+        REQUIRE(check);
+    }
+
+    SUBCASE("Self reference") {
+        Vector<std::string> strings{"Hello"};
+        strings.push_back(strings[0]);
+        strings.emplace_back(strings[1]);
+
+        Vector<int> ints{7};
+        ints.shrink_to_fit();
+        ints.push_back(ints[0]);
+
+        bool check = strings.size() == 3 && strings[2] == "Hello" && ints[1] == 7;
+        REQUIRE(check);
+    }
+
+    SUBCASE("Self reference in the middle") {
+        Vector<int> ints{1, 2};
+        ints.reserve(10);
+        ints.emplace(ints.begin(), ints[1]);
+        ints.insert(ints.begin(), ints[2]);
+        ints.insert(ints.begin() + 1, 2, ints[0]);
+
+        Vector<std::string> strings{"a", "b"};
+        strings.reserve(10);
+        strings.emplace(strings.begin(), strings[1]);
+        strings.insert(strings.begin() + 1, strings[2]);
+        strings.insert(strings.begin(), std::move(strings[3]));
+
+        // Growing inserts copy from the old buffer
+        Vector<std::string> full{"x", "y"};
+        full.shrink_to_fit();
+        full.insert(full.begin() + 1, 3, full[0]);
+
+        bool check = ints.size() == 6 && ints[0] == 2 && ints[1] == 2 && ints[2] == 2 && ints[3] == 2 &&
+                     ints[4] == 1 && ints[5] == 2;
+        REQUIRE(check);
+
+        check = strings.size() == 5 && strings[0] == "b" && strings[1] == "b" && strings[2] == "b" &&
+                strings[3] == "a" && strings[4].empty();
+        REQUIRE(check);
+
+        check = full.size() == 5 && full[1] == "x" && full[3] == "x" && full[4] == "y";
+        REQUIRE(check);
+    }
+}
+
+TEST_CASE("Ranges") {
+    Vector<std::string> v{"Hello", "World"};
+
+    SUBCASE("Sized and forward ranges grow once") {
+        Vector<int> ints;
+        ints.append_range(std::views::iota(0, 100));
+        bool check = ints.size() == 100 && ints.capacity() == 100 && ints[99] == 99;
+        REQUIRE(check);
+
+        std::forward_list<int> forwardList{1, 2, 3};
+        Vector<int> fromList;
+        fromList.append_range(forwardList);
+        check = fromList.capacity() == 3 && fromList[2] == 3;
+        REQUIRE(check);
+    }
+
+    SUBCASE("insert_range") {
+        std::list<std::string> list{"One", "Two"};
+        auto inserted = v.insert_range(v.begin(), list);
+        bool check = *inserted == "One" && v.size() == 4 && v[2] == "Hello" && list.front() == "One";
+        REQUIRE(check);
+
+        std::vector<std::string> strings{"Three", "Four"};
+        auto iter = v.begin();
+        iter += 4;
+        v.insert(iter, strings.begin(), strings.end());
+        check = v[4] == "Three" && v[5] == "Four";
+        REQUIRE(check);
+    }
+
+    SUBCASE("Moving elements") {
+        std::vector<std::string> strings{"A long string which is not stored inline", "Two"};
+        v.append_range(std::move(strings));
+        bool check = v[2] == "A long string which is not stored inline" && strings[0].empty();
+        REQUIRE(check);
+
+        std::vector<std::string> strings2{"Three"};
+        v.append_range(std::make_move_iterator(strings2.begin()), std::make_move_iterator(strings2.end()));
+        check = v.size() == 5 && v[4] == "Three" && strings2[0].empty();
+        REQUIRE(check);
+    }
+
+    SUBCASE("Input only ranges") {
+        std::istringstream input{"1 2 3 4"};
+        Vector<int> ints{10, 20};
+        ints.insert_range(ints.begin(), std::views::istream<int>(input));
+        bool check = ints.size() == 6 && ints[0] == 1 && ints[3] == 4 && ints[4] == 10;
+        REQUIRE(check);
+    }
+}
+
+TEST_CASE("Statistics") {
+    // Disabled statistics don't take any space
+    static_assert(sizeof(Vector<int>) == 3 * sizeof(size_t));
+
+    VectorStats::resetTotals();
+    StatsVector<std::string> v;
+
+    for (int i = 0; i < 10; i++) {
+        v.push_back(std::to_string(i));
+    }
+
+    SUBCASE("Growth") {
+        // Capacities 1, 2, 3, 4, 6, 9, 13
+        const VectorStatsCounters &counters = v.stats().counters();
+        bool check = counters.allocations == 7 && counters.deallocations == 6 && counters.relocations == 6 &&
+                     counters.elemsMoved == 1 + 2 + 3 + 4 + 6 + 9 &&
+                     counters.peakCapacityBytes == 13 * sizeof(std::string);
+        REQUIRE(check);
+    }
+
+    SUBCASE("Inserts and erases") {
+        v.reserve(20);
+        const size_t movedBefore = v.stats().counters().elemsMoved;
+
+        v.insert(v.begin(), "Front");
+        v.erase(v.begin() + 5);
+        REQUIRE(v.stats().counters().elemsMoved == movedBefore + 10 + 5);
+    }
+
+    SUBCASE("Totals") {
+        StatsVector<int> ints{1, 2, 3};
+        ints.push_back(4);
+
+        const VectorStatsCounters totals = VectorStats::totals();
+        bool check = totals.allocations == v.stats().counters().allocations + ints.stats().counters().allocations &&
+                     totals.peakCapacityBytes >= 13 * sizeof(std::string);
+        REQUIRE(check);
+    }
+}
+
+TEST_CASE("Resize") {
+    Vector<std::string> v{"One", "Two", "Three"};
+
+    SUBCASE("Value initialized") {
+        v.resize(5);
+        bool check = v.size() == 5 && v[2] == "Three" && v[4].empty();
+        REQUIRE(check);
+
+        v.resize(1);
+        check = v.size() == 1 && v[0] == "One";
+        REQUIRE(check);
+
+        Vector<int> ints{1};
+        ints.resize(100);
+        check = ints[0] == 1 && ints[1] == 0 && ints[99] == 0;
+        REQUIRE(check);
+    }
+
+    SUBCASE("Filled") {
+        v.shrink_to_fit();
+        v.resize(6, v[0]); // Reallocates while referring to an own element
+        bool check = v.size() == 6 && v[3] == "One" && v[5] == "One";
+        REQUIRE(check);
+    }
+
+    SUBCASE("For overwrite") {
+        const char payload[] = "Data received from the network";
+        Vector<uint8_t> buffer;
+        buffer.resize_for_overwrite(sizeof(payload));
+        std::memcpy(buffer.data(), payload, sizeof(payload));
+
+        bool check = buffer.size() == sizeof(payload) && std::strcmp((const char *) buffer.data(), payload) == 0;
+        REQUIRE(check);
+
+        v.resize_for_overwrite(4);
+        check = v.size() == 4 && v[3].empty();
+        REQUIRE(check);
+    }
+}
+
+TEST_CASE("Bulk erase") {
+    Vector<int> ints;
+    Vector<std::string> strings;
+
+    for (int i = 0; i < 20; i++) {
+        ints.push_back(i);
+        strings.push_back(std::to_string(i));
+    }
+
+    SUBCASE("Erase returns the following element") {
+        auto next = ints.erase(ints.begin() + 3);
+        bool check = *next == 4 && ints.size() == 19;
+        REQUIRE(check);
+
+        next = ints.erase(ints.begin(), ints.begin() + 2);
+        check = *next == 2 && ints.size() == 17;
+        REQUIRE(check);
+
+        // Empty ranges don't touch the elements
+        auto stringNext = strings.erase(strings.begin() + 3, strings.begin() + 3);
+        check = stringNext == strings.begin() + 3 && strings.size() == 20 && strings[3] == "3" && strings[19] == "19";
+        REQUIRE(check);
+    }
+
+    SUBCASE("Erase if") {
+        size_t erased = ints.erase_if([](int value) { return value % 3 == 0; });
+        bool check = erased == 7 && ints.size() == 13 && ints[0] == 1 && ints[1] == 2 && ints[2] == 4 &&
+                     ints[12] == 19;
+        REQUIRE(check);
+
+        erased = erase_if(strings, [](const std::string &value) { return value.size() == 1; });
+        check = erased == 10 && strings.size() == 10 && strings[0] == "10" && strings[9] == "19";
+        REQUIRE(check);
+
+        erased = ints.erase_if([](int) { return false; });
+        check = erased == 0 && ints.size() == 13;
+        REQUIRE(check);
+    }
+
+    SUBCASE("Erase indices") {
+        const size_t indices[] = {0, 5, 5, 6, 19};
+        size_t erased = strings.erase_indices(indices);
+        bool check = erased == 4 && strings.size() == 16 && strings[0] == "1" && strings[4] == "7" &&
+                     strings[15] == "18";
+        REQUIRE(check);
+
+        const size_t unsorted[] = {3, 1};
+        REQUIRE_THROWS_AS(ints.erase_indices(unsorted), std::invalid_argument);
+
+        const size_t outOfRange[] = {1, 20};
+        REQUIRE_THROWS_AS(ints.erase_indices(outOfRange), std::out_of_range);
+        check = ints.size() == 20;
+        REQUIRE(check);
+    }
+
+    SUBCASE("Throwing predicate") {
+        int calls = 0;
+
+        REQUIRE_THROWS(strings.erase_if([&calls](const std::string &) {
+            if (++calls == 10) {
+                throw std::runtime_error("Predicate failed");
+            }
+
+            return calls % 2 == 0;
+        }));
+
+        // The elements checked so far are compacted, the rest is kept
+        bool check = strings.size() == 16 && strings[0] == "0" && strings[1] == "2" && strings[4] == "8" &&
+                     strings[5] == "9" && strings[15] == "19";
+        REQUIRE(check);
+    }
+}
+
+TEST_CASE("Unordered erase") {
+    Vector<std::string> strings;
+    Vector<Tick> ticks;
+
+    for (int i = 0; i < 10; i++) {
+        strings.push_back(std::to_string(i));
+        ticks.push_back({(uint64_t) i, (double) i, i});
+    }
+
+    SUBCASE("Single elements") {
+        auto pos = strings.erase_unordered(strings.begin() + 2);
+        bool check = *pos == "9" && strings.size() == 9 && strings[8] == "8";
+        REQUIRE(check);
+
+        strings.erase_unordered(8);
+        check = strings.size() == 8 && strings[7] == "7";
+        REQUIRE(check);
+
+        ticks.erase_unordered(0);
+        check = ticks.size() == 9 && ticks[0].timestamp == 9 && ticks[8].timestamp == 8;
+        REQUIRE(check);
+
+        REQUIRE_THROWS_AS(ticks.erase_unordered(9), std::out_of_range);
+    }
+
+    SUBCASE("Batch") {
+        const size_t indices[] = {0, 3, 3, 8, 9};
+        strings.erase_unordered(indices);
+        ticks.erase_unordered(indices);
+
+        std::vector<std::string> remaining(strings.begin(), strings.end());
+        std::ranges::sort(remaining);
+        bool check = remaining == std::vector<std::string>{"1", "2", "4", "5", "6", "7"};
+        REQUIRE(check);
+
+        check = ticks.size() == 6 && std::ranges::none_of(ticks, [](const Tick &tick) {
+            return tick.timestamp == 0 || tick.timestamp == 3 || tick.timestamp == 8 || tick.timestamp == 9;
+        });
+        REQUIRE(check);
+    }
+}
+
+TEST_CASE("SIMD algorithms") {
+    // Odd sizes leave tails for the scalar loops
+    Vector<int32_t> ints;
+    Vector<float> floats;
+    uint32_t seed = 12345;
+
+    for (int i = 0; i < 1003; i++) {
+        seed = seed * 1664525 + 1013904223;
+        ints.push_back((int32_t) seed);
+        // Integer values keep the float sums exact in any order
+        floats.push_back((float) (int32_t) (seed >> 16) - 30000.0f);
+    }
+
+    ints[500] = 42;
+    ints[700] = 42;
+    floats[900] = 0.5f;
+
+    const SimdLevel supported = supportedSimdLevel();
+
+    for (SimdLevel level: {SimdLevel::Scalar, SimdLevel::Sse2, SimdLevel::Avx2, SimdLevel::Avx512}) {
+        if (level > supported) {
+            break;
+        }
+
+        CAPTURE((int) level);
+
+        bool check = simdFind(ints, 42, level) == 500 && simdCount(ints, 42, level) == 2 &&
+                     simdFind(ints, ints[1002], level) == ScalarKernels::find(ints.data(), 0, 1003, ints[1002]) &&
+                     simdFind(floats, 0.5f, level) == 900 && simdFind(floats, 0.25f, level) == floats.size();
+        REQUIRE(check);
+
+        check = simdCount(floats, floats[3], level) == ScalarKernels::count(floats.data(), 0, 1003, floats[3]);
+        REQUIRE(check);
+
+        check = simdMin(ints, level) == *std::ranges::min_element(ints) &&
+                simdMax(ints, level) == *std::ranges::max_element(ints) &&
+                simdMin(floats, level) == *std::ranges::min_element(floats) &&
+                simdMax(floats, level) == *std::ranges::max_element(floats);
+        REQUIRE(check);
+
+        check = simdSum(ints, level) == ScalarKernels::sum(ints.data(), 0, 1003) &&
+                simdSum(floats, level) == ScalarKernels::sum(floats.data(), 0, 1003);
+        REQUIRE(check);
+
+        // Shorter than a register
+        const std::span<const int32_t> head(ints.data(), 3);
+        check = simdMin(head, level) == std::min({ints[0], ints[1], ints[2]}) && simdSum(head, level) ==
+                (int64_t) ints[0] + ints[1] + ints[2];
+        REQUIRE(check);
+    }
+
+    Vector<double> empty;
+    REQUIRE_THROWS_AS(simdMin(empty), std::out_of_range);
+    REQUIRE(simdSum(empty) == 0.0);
+    REQUIRE(simdFind(empty, 1.0) == 0);
+}
+
+TEST_CASE("Structure of arrays") {
+    SoaVector<int, std::string, double> v;
+
+    for (int i = 0; i < 100; i++) {
+        v.push_back(i, std::to_string(i), i * 0.5);
+    }
+
+    SUBCASE("Columns") {
+        std::span<int> ids = v.column<0>();
+        std::span<double> values = v.column<2>();
+
+        bool check = v.size() == 100 && ids.size() == 100 && ids[42] == 42 && values[99] == 49.5 &&
+                     v.column<1>()[7] == "7";
+        REQUIRE(check);
+
+        // Every column is contiguous and starts on its own cache line
+        check = (uintptr_t) ids.data() % 64 == 0 && (uintptr_t) v.column<1>().data() % 64 == 0 &&
+                (uintptr_t) values.data() % 64 == 0;
+        REQUIRE(check);
+
+        int sum = 0;
+
+        for (int id: ids) {
+            sum += id;
+        }
+
+        REQUIRE(sum == 4950);
+    }
+
+    SUBCASE("Rows") {
+        auto [id, name, value] = v[10];
+        bool check = id == 10 && name == "10" && value == 5.0;
+        REQUIRE(check);
+
+        // Proxy references write through to the columns
+        for (auto [rowId, rowName, rowValue]: v) {
+            rowValue += rowId;
+            rowName += "!";
+        }
+
+        check = v.column<2>()[10] == 15.0 && std::get<1>(v.at(99)) == "99!";
+        REQUIRE(check);
+
+        const auto &constV = v;
+        check = std::get<0>(*(constV.begin() + 5)) == 5 && constV.end() - constV.begin() == 100 &&
+                std::distance(v.begin(), v.end()) == 100;
+        REQUIRE(check);
+
+        REQUIRE_THROWS_AS(v.at(100), std::out_of_range);
+
+        // Random access for the C++20 iterator concepts, legacy algorithms only see input iterators
+        using Rows = SoaVector<int, std::string, double>;
+        static_assert(std::random_access_iterator<Rows::iterator>);
+        static_assert(std::random_access_iterator<Rows::const_iterator>);
+        static_assert(std::ranges::random_access_range<const Rows>);
+
+        auto found = std::ranges::find_if(constV, [](const auto &row) { return std::get<1>(row) == "42!"; });
+        check = found - constV.begin() == 42 && std::get<0>(constV.begin()[42]) == 42;
+        REQUIRE(check);
+    }
+
+    SUBCASE("Growth and copies") {
+        // Arguments referring to our own rows survive the reallocation
+        const size_t capacity = v.capacity();
+        while (v.size() < capacity) {
+            v.push_back(0, "", 0.0);
+        }
+
+        v.emplace_back(std::get<0>(v[1]), std::get<1>(v[1]), std::get<2>(v[1]));
+        bool check = v.capacity() > capacity && std::get<1>(v[v.size() - 1]) == "1";
+        REQUIRE(check);
+
+        SoaVector<int, std::string, double> copy = v;
+        v.pop_back();
+        v.clear();
+        // Like Vector, popping an empty container does nothing
+        v.pop_back();
+
+        check = v.empty() && copy.size() == capacity + 1 && copy.column<1>()[50] == "50";
+        REQUIRE(check);
+
+        v = std::move(copy);
+        check = v.size() == capacity + 1 && std::get<0>(v[99]) == 99;
+        REQUIRE(check);
+    }
+}
+
+TEST_CASE("Stable vector") {
+    StableVector<std::string, 4> v;
+    std::string &first = v.emplace_back("First");
+    const std::string *firstPtr = &first;
+
+    for (int i = 1; i < 1000; i++) {
+        v.push_back(std::to_string(i));
+    }
+
+    SUBCASE("Pointers stay valid") {
+        // Blocks of 4, 8, 16, ... elements
+        bool check = v.size() == 1000 && &v[0] == firstPtr && *firstPtr == "First" && v.block_count() == 8 &&
+                     v.capacity() == 1020;
+        REQUIRE(check);
+
+        // Arguments referring to own elements survive new blocks
+        const std::string *ptr = &v[500];
+        while (v.size() < v.capacity()) {
+            v.push_back(v[500]);
+        }
+
+        v.push_back(v[500]);
+        check = &v[500] == ptr && v.back() == "500" && v.block_count() == 9;
+        REQUIRE(check);
+    }
+
+    SUBCASE("Indexing and iteration") {
+        bool check = v[3] == "3" && v[4] == "4" && v[11] == "11" && v[12] == "12" && v.at(999) == "999";
+        REQUIRE(check);
+        REQUIRE_THROWS_AS(v.at(1000), std::out_of_range);
+
+        size_t count = 0;
+
+        for (const std::string &value: v) {
+            if (count > 0 && value != std::to_string(count)) {
+                break;
+            }
+
+            count++;
+        }
+
+        REQUIRE(count == 1000);
+
+        static_assert(std::random_access_iterator<StableVector<int>::iterator>);
+        auto found = std::find(v.begin(), v.end(), "777");
+        check = found - v.begin() == 777 && *(v.cbegin() + 10) == "10";
+        REQUIRE(check);
+    }
+
+    SUBCASE("Pop back and shrink") {
+        while (v.size() > 10) {
+            v.pop_back();
+        }
+
+        v.shrink_to_fit();
+        bool check = v.size() == 10 && v.block_count() == 2 && v.capacity() == 12 && v.back() == "9";
+        REQUIRE(check);
+
+        StableVector<std::string, 4> copy = v;
+        v.clear();
+        v.shrink_to_fit();
+        v.pop_back();
+
+        check = v.empty() && v.capacity() == 0 && copy.size() == 10 && copy[0] == "First";
+        REQUIRE(check);
+
+        StableVector<std::string, 4> moved = std::move(copy);
+        check = moved.size() == 10 && copy.empty();
+        REQUIRE(check);
+
+        // Assignment reuses the blocks, moves hand them over
+        copy = moved;
+        moved = std::move(v);
+        check = copy.size() == 10 && copy[9] == "9" && moved.empty();
+        REQUIRE(check);
+    }
+
+    SUBCASE("pmr") {
+        using PmrStableVector = StableVector<std::string, 4, std::pmr::polymorphic_allocator<std::string>>;
+        std::pmr::monotonic_buffer_resource arena;
+        std::pmr::monotonic_buffer_resource otherArena;
+        PmrStableVector first{&arena};
+        PmrStableVector second{&otherArena};
+        first.push_back("One");
+        second.push_back("Two");
+
+        // Different resources, the elements are moved and every vector keeps its resource
+        first = std::move(second);
+        bool check = first.size() == 1 && first[0] == "Two" && second.empty() &&
+                     first.get_allocator().resource() == &arena && second.get_allocator().resource() == &otherArena;
+        REQUIRE(check);
+
+        PmrStableVector third{&arena};
+        third.push_back("Three");
+        swap(first, third);
+        first = third;
+        check = first.size() == 1 && first[0] == "Two" && third[0] == "Two" &&
+                first.get_allocator().resource() == &arena;
+        REQUIRE(check);
+    }
+}
+
+// Runs the hook once on the next copy, lets tests act in the middle of a container operation
+struct CopyHook {
+    static inline std::function<void()> hook;
+
+    std::string value;
+
+    explicit CopyHook(std::string value) : value{std::move(value)} {}
+
+    CopyHook(const CopyHook &other) : value{other.value} {
+        if (hook) {
+            std::exchange(hook, nullptr)();
+        }
+    }
+
+    CopyHook &operator=(const CopyHook &other) = default;
+};
+
+TEST_CASE("Copy on write") {
+    CowVector<std::string> v{"One", "Two", "Three"};
+    CowVector<std::string> snapshot = v;
+
+    SUBCASE("Copies share the buffer") {
+        const auto &constV = v;
+        bool check = v.is_shared() && snapshot.use_count() == 2 && constV.data() == std::as_const(snapshot).data() &&
+                     constV[1] == "Two" && constV.at(2) == "Three" && std::ranges::equal(constV, snapshot.vector());
+        REQUIRE(check);
+        // Reads don't detach
+        REQUIRE(v.is_shared());
+    }
+
+    SUBCASE("First mutation detaches") {
+        v[0] = "Changed";
+        bool check = !v.is_shared() && !snapshot.is_shared() && v[0] == "Changed" &&
+                     std::as_const(snapshot)[0] == "One";
+        REQUIRE(check);
+
+        // Unshared buffers are mutated in place
+        const std::string *data = std::as_const(v).data();
+        v.erase(v.cbegin());
+        v[1] = "Four";
+        check = v.size() == 2 && std::as_const(v)[0] == "Two" && std::as_const(v).data() == data &&
+                snapshot.back() == "Three";
+        REQUIRE(check);
+    }
+
+    SUBCASE("Modifiers") {
+        // Refers to the shared buffer while detaching
+        v.push_back(std::as_const(v)[0]);
+        v.insert(v.cbegin() + 1, "Inserted");
+        snapshot.erase(snapshot.cbegin(), snapshot.cbegin() + 2);
+
+        bool check = v.size() == 5 && std::as_const(v)[1] == "Inserted" && std::as_const(v)[4] == "One" &&
+                     snapshot.size() == 1 && snapshot.front() == "Three";
+        REQUIRE(check);
+
+        CowVector<std::string> other = v;
+        other.clear();
+        other.pop_back();
+        check = other.empty() && v.size() == 5 && !v.is_shared();
+        REQUIRE(check);
+
+        for (std::string &value: other = v) {
+            value += "!";
+        }
+
+        check = other.back() == "One!" && v.back() == "One";
+        REQUIRE(check);
+    }
+
+    SUBCASE("Argument outlives the released buffer") {
+        CowVector<CopyHook> hooked{CopyHook{"One"}, CopyHook{"Two"}};
+        auto other = std::make_unique<CowVector<CopyHook>>(hooked);
+
+        // Stands in for another thread dropping the last other copy while the buffer gets detached
+        CopyHook::hook = [&other] { other.reset(); };
+        hooked.push_back(std::as_const(hooked)[0]);
+
+        bool check = !other && !hooked.is_shared() && hooked.size() == 3 && std::as_const(hooked)[2].value == "One";
+        REQUIRE(check);
+    }
+
+    SUBCASE("Snapshot handed to another stage") {
+        snapshot = CowVector<std::string>();
+        std::atomic<size_t> readChars{0};
+
+        std::thread stage([copy = v, &readChars] {
+            for (const std::string &value: copy.vector()) {
+                readChars += value.size();
+            }
+        });
+
+        // Once the stage dropped its copy, writes go to the buffer it read
+        while (v.is_shared()) {
+            std::this_thread::yield();
+        }
+
+        const std::string *data = std::as_const(v).data();
+        v[0] = "Changed";
+        stage.join();
+
+        bool check = readChars == 11 && std::as_const(v).data() == data && v[0] == "Changed";
+        REQUIRE(check);
+    }
+}
+
+template<typename T>
+bool samePersistentValues(const PersistentVector<T> &persistent, const std::vector<T> &expected) {
+    if (persistent.size() != expected.size()) {
+        return false;
+    }
+
+    for (size_t i = 0; i < expected.size(); i++) {
+        if (persistent[i] != expected[i]) {
+            return false;
+        }
+    }
+
+    return std::equal(persistent.begin(), persistent.end(), expected.begin(), expected.end());
+}
+
+TEST_CASE("Persistent vector") {
+    PersistentVector<int> empty;
+    PersistentVector<int> v;
+    std::vector<int> expected;
+
+    for (int i = 0; i < 2000; i++) {
+        v = v.push_back(i);
+        expected.push_back(i);
+    }
+
+    SUBCASE("Versions share structure") {
+        PersistentVector<int> next = v.push_back(2000);
+        PersistentVector<int> changed = next.set(5, -5);
+
+        bool check = samePersistentValues(v, expected) && next.size() == 2001 && next.back() == 2000 &&
+                     changed[5] == -5 && next[5] == 5 && v.height() == 2 && empty.push_back(1).front() == 1;
+        REQUIRE(check);
+
+        // Untouched leaves are the same memory
+        check = &next[100] == &v[100] && &changed[100] == &v[100] && &changed[5] != &v[5];
+        REQUIRE(check);
+
+        REQUIRE_THROWS_AS((void) v.set(2000, 1), std::out_of_range);
+        REQUIRE_THROWS_AS(v.at(2000), std::out_of_range);
+    }
+
+    SUBCASE("Slice and concat") {
+        PersistentVector<int> middle = v.slice(37, 1500);
+        bool check = samePersistentValues(middle, std::vector<int>(expected.begin() + 37, expected.begin() + 1500)) &&
+                     v.slice(5, 5).empty() && samePersistentValues(v.slice(0, 10), {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+        REQUIRE(check);
+
+        // Repeated concatenations of uneven slices stay balanced
+        PersistentVector<int> combined;
+        std::vector<int> combinedExpected;
+        size_t from = 0;
+
+        for (size_t length = 1; from + length <= expected.size(); from += length, length += 7) {
+            combined = combined.concat(v.slice(from, from + length));
+            combinedExpected.insert(combinedExpected.end(), expected.begin() + from, expected.begin() + from + length);
+        }
+
+        check = samePersistentValues(combined, combinedExpected) && combined.height() <= 3;
+        REQUIRE(check);
+
+        PersistentVector<int> twice = combined.concat(middle).concat(combined.slice(3, 900));
+        combinedExpected.insert(combinedExpected.end(), expected.begin() + 37, expected.begin() + 1500);
+        combinedExpected.insert(combinedExpected.end(), combinedExpected.begin() + 3, combinedExpected.begin() + 900);
+        check = samePersistentValues(twice, combinedExpected) && samePersistentValues(v, expected);
+        REQUIRE(check);
+
+        // Random splits and joins against the std::vector model
+        uint32_t seed = 7;
+        PersistentVector<int> random = v;
+        std::vector<int> randomExpected = expected;
+
+        for (int round = 0; round < 100; round++) {
+            seed = seed * 1664525 + 1013904223;
+            const size_t cut = seed % (random.size() + 1);
+            seed = seed * 1664525 + 1013904223;
+            const size_t otherCut = seed % (expected.size() + 1);
+
+            random = random.slice(0, cut).concat(v.slice(otherCut, expected.size()))
+                    .concat(random.slice(cut, random.size()));
+            randomExpected.insert(randomExpected.begin() + (std::ptrdiff_t) cut,
+                                  expected.begin() + (std::ptrdiff_t) otherCut, expected.end());
+
+            if (random.size() > 20000) {
+                random = random.slice(random.size() - 5000, random.size());
+                randomExpected.erase(randomExpected.begin(), randomExpected.end() - 5000);
+            }
+        }
+
+        check = samePersistentValues(random, randomExpected) && random.height() <= 4;
+        REQUIRE(check);
+
+        // Relaxed trees still take appends and updates
+        PersistentVector<int> appended = twice.push_back(-1).set(1234, -2);
+        combinedExpected.push_back(-1);
+        combinedExpected[1234] = -2;
+        REQUIRE(samePersistentValues(appended, combinedExpected));
+    }
+
+    SUBCASE("Transient and conversions") {
+        auto transient = v.transient();
+
+        for (int i = 2000; i < 5000; i++) {
+            transient.push_back(i);
+            expected.push_back(i);
+        }
+
+        transient.set(0, -1);
+        expected[0] = -1;
+        PersistentVector<int> built = transient.persistent();
+
+        bool check = samePersistentValues(built, expected) && v[0] == 0 && v.size() == 2000 && transient.size() == 0;
+        REQUIRE(check);
+
+        Vector<int> flat = built.toVector();
+        PersistentVector<int> fromFlat(flat);
+        check = flat.size() == 5000 && std::equal(flat.begin(), flat.end(), expected.begin()) &&
+                samePersistentValues(fromFlat, expected);
+        REQUIRE(check);
+
+        PersistentVector<std::string> strings{"One", "Two"};
+        PersistentVector<std::string> more = strings.push_back("Three");
+        check = strings.toVector().size() == 2 && more.toVector()[2] == "Three" && strings[1] == "Two";
+        REQUIRE(check);
+    }
+
+    SUBCASE("Transient racing released readers") {
+        auto transient = v.transient();
+        std::atomic<int64_t> readSum{0};
+
+        // Drops the last other reference to the shared nodes while the transient edits them
+        std::thread reader([version = std::move(v), &readSum]() mutable {
+            int64_t sum = 0;
+
+            for (int value: version) {
+                sum += value;
+            }
+
+            readSum = sum;
+            version = PersistentVector<int>();
+        });
+
+        for (int round = 0; round < 20; round++) {
+            for (size_t i = 0; i < expected.size(); i++) {
+                transient.set(i, -round);
+            }
+        }
+
+        reader.join();
+
+        // Nodes the transient copied are its own, later edits stay in place
+        const int *first = &transient[0];
+        transient.set(0, 1);
+        bool check = readSum == 1999000 && first == &transient[0] && transient[0] == 1 && transient[1999] == -19;
+        REQUIRE(check);
+    }
+}
+
+// Throws bad_alloc once its budget of allocations is used up
+template<typename T>
+struct LimitedAllocator {
+    using value_type = T;
+
+    static inline size_t remaining = 0;
+
+    T *allocate(size_t count) {
+        if (remaining == 0) {
+            throw std::bad_alloc();
+        }
+
+        remaining--;
+        return std::allocator<T>{}.allocate(count);
+    }
+
+    void deallocate(T *ptr, size_t count) {
+        std::allocator<T>{}.deallocate(ptr, count);
+    }
+
+    bool operator==(const LimitedAllocator &) const = default;
+};
+
+TEST_CASE("Concurrent vector") {
+    constexpr size_t threadCount = 8;
+    constexpr size_t perThread = 20000;
+
+    ConcurrentVector<size_t, 16> v;
+    const size_t first = v.push_back(0);
+    const size_t *firstPtr = &v[first];
+
+    std::atomic<bool> done{false};
+    std::atomic<bool> readerFailed{false};
+    std::atomic<bool> writerFailed{false};
+
+    // Published elements are always fully constructed
+    std::thread reader([&] {
+        while (!done.load()) {
+            const size_t size = v.size();
+
+            if (size > 1 && v[size - 1] / perThread > threadCount) {
+                readerFailed = true;
+            }
+        }
+    });
+
+    std::vector<std::thread> writers;
+
+    for (size_t thread = 0; thread < threadCount; thread++) {
+        writers.emplace_back([&v, &writerFailed, thread] {
+            for (size_t i = 0; i < perThread; i++) {
+                const size_t index = v.emplace_back(thread * perThread + i);
+
+                if (v[index] != thread * perThread + i) {
+                    writerFailed = true;
+                }
+            }
+        });
+    }
+
+    for (std::thread &writer: writers) {
+        writer.join();
+    }
+
+    done = true;
+    reader.join();
+
+    std::vector<size_t> values(v.begin(), v.end());
+    std::ranges::sort(values);
+
+    bool check = !readerFailed && !writerFailed && v.size() == threadCount * perThread + 1 && &v[0] == firstPtr &&
+                 values[0] == 0 && values[1] == 0 && values.back() == threadCount * perThread - 1 &&
+                 std::adjacent_find(values.begin() + 1, values.end()) == values.end();
+    REQUIRE(check);
+
+    ConcurrentVector<std::string> strings(100);
+    strings.push_back("One");
+    strings.emplace_back(3, 'x');
+    check = strings.size() == 2 && strings.at(1) == "xxx";
+    REQUIRE(check);
+    REQUIRE_THROWS_AS(strings.at(2), std::out_of_range);
+
+    // A failed segment allocation claims no slot, later appends still get published
+    ConcurrentVector<int, 4, LimitedAllocator<int>> limited;
+    LimitedAllocator<int>::remaining = 1;
+
+    for (int i = 0; i < 4; i++) {
+        limited.push_back(i);
+    }
+
+    REQUIRE_THROWS_AS(limited.push_back(4), std::bad_alloc);
+    LimitedAllocator<int>::remaining = 1;
+    limited.push_back(4);
+    check = limited.size() == 5 && limited[4] == 4;
+    REQUIRE(check);
+}
+
+TEST_CASE("RCU vector") {
+    SUBCASE("Pinned buffers outlive growth") {
+        RcuVector<std::string> v;
+        auto reader = v.register_reader();
+        v.push_back("First");
+
+        {
+            auto guard = reader.pin();
+            const size_t capacity = v.capacity();
+
+            for (int i = 0; i < 100; i++) {
+                v.push_back(std::to_string(i));
+            }
+
+            // The pinned snapshot still reads the old buffer
+            bool check = v.capacity() > capacity && v.retired_count() > 0 && guard.size() == 1 && guard[0] == "First";
+            REQUIRE(check);
+        }
+
+        v.reclaim();
+        auto guard = reader.pin();
+        bool check = v.retired_count() == 0 && guard.size() == 101 && guard.at(100) == "99" &&
+                     std::distance(guard.begin(), guard.end()) == 101;
+        REQUIRE(check);
+
+        v.clear();
+        check = v.empty() && guard.size() == 101 && guard[50] == "49";
+        REQUIRE(check);
+    }
+
+    SUBCASE("Concurrent readers") {
+        constexpr size_t elemCount = 200000;
+        RcuVector<size_t, 8> v;
+        std::atomic<bool> done{false};
+        std::atomic<bool> readerFailed{false};
+        std::vector<std::thread> readers;
+
+        for (int i = 0; i < 4; i++) {
+            readers.emplace_back([&v, &done, &readerFailed] {
+                auto reader = v.register_reader();
+
+                while (!done.load()) {
+                    auto guard = reader.pin();
+
+                    for (size_t index = 0; index < guard.size(); index++) {
+                        if (guard[index] != index) {
+                            readerFailed = true;
+                        }
+                    }
+                }
+            });
+        }
+
+        for (size_t i = 0; i < elemCount; i++) {
+            v.push_back(i);
+        }
+
+        done = true;
+
+        for (std::thread &reader: readers) {
+            reader.join();
+        }
+
+        v.reclaim();
+        bool check = !readerFailed && v.size() == elemCount && v[elemCount - 1] == elemCount - 1 &&
+                     v.retired_count() == 0;
+        REQUIRE(check);
+
+        std::vector<RcuVector<size_t, 8>::Reader> registered;
+
+        for (int i = 0; i < 8; i++) {
+            registered.push_back(v.register_reader());
+        }
+
+        REQUIRE_THROWS_AS(v.register_reader(), std::length_error);
+    }
+}
+
+TEST_CASE("Memory mapped vector") {
+    const std::string path = (std::filesystem::temp_directory_path() /
+                              ("mapped_vector_test_" + std::to_string(getpid()))).string();
+    std::filesystem::remove(path);
+
+    {
+        MappedVector<Tick> v(path);
+        REQUIRE(v.empty());
+
+        for (uint64_t i = 0; i < 100000; i++) {
+            v.push_back({i, i * 0.5, (int32_t) i});
+        }
+
+        v.emplace_back(Tick{1, 2.0, 3});
+        v.pop_back();
+        v.flush();
+
+        bool check = v.size() == 100000 && v.capacity() >= 100000 && v[99999].volume == 99999;
+        REQUIRE(check);
+    }
+
+    SUBCASE("Reopened") {
+        MappedVector<Tick> v(path);
+        bool check = v.size() == 100000 && v[12345].timestamp == 12345 && v.back().price == 99999 * 0.5;
+        REQUIRE(check);
+
+        uint64_t sum = 0;
+
+        for (const Tick &tick: v) {
+            sum += tick.timestamp;
+        }
+
+        REQUIRE(sum == uint64_t{99999} * 100000 / 2);
+
+        v.resize(200000);
+        v.shrink_to_fit();
+        check = v.size() == 200000 && v[150000].timestamp == 0 && v.capacity() >= 200000 &&
+                std::filesystem::file_size(path) < 64 + 200001 * sizeof(Tick) + 4096;
+        REQUIRE(check);
+
+        MappedVector<Tick> moved = std::move(v);
+        moved.clear();
+        moved.pop_back();
+        REQUIRE(moved.empty());
+
+        // Nothing mapped anymore, acts as an empty vector
+        v.clear();
+        v.pop_back();
+        v.flush();
+        v.shrink_to_fit();
+        check = v.empty() && v.size() == 0 && v.capacity() == 0 && v.begin() == v.end();
+        REQUIRE(check);
+        REQUIRE_THROWS_AS(v.push_back(Tick{}), std::runtime_error);
+        REQUIRE_THROWS_AS(v.at(0), std::out_of_range);
+    }
+
+    SUBCASE("Wrong element type") {
+        REQUIRE_THROWS_AS(MappedVector<int>{path}, std::runtime_error);
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Serialization") {
+    Vector<Tick> ticks;
+
+    for (uint64_t i = 0; i < 1000; i++) {
+        ticks.push_back({i, i * 0.25, (int32_t) i});
+    }
+
+    std::stringstream stream;
+    writeVector(stream, ticks);
+    const std::string bytes = stream.str();
+    REQUIRE(bytes.size() == serializedBytes<Tick>(1000));
+
+    SUBCASE("Round trip") {
+        Vector<Tick> read = readVector<Tick>(stream);
+        bool check = read.size() == 1000 && read[999].timestamp == 999 && read[500].price == 125.0 &&
+                     std::memcmp(read.data(), ticks.data(), 1000 * sizeof(Tick)) == 0;
+        REQUIRE(check);
+
+        std::stringstream intStream;
+        writeVector(intStream, std::vector<int>{1, 2, 3});
+        Vector<int> ints{9, 9, 9, 9, 9};
+        readVector(intStream, ints);
+        check = ints.size() == 3 && ints[0] == 1 && ints[2] == 3;
+        REQUIRE(check);
+
+        std::stringstream emptyStream;
+        writeVector(emptyStream, Vector<int>{});
+        REQUIRE(readVector<int>(emptyStream).empty());
+    }
+
+    SUBCASE("Rejected input") {
+        REQUIRE_THROWS_AS(readVector<int>(stream), std::runtime_error);
+
+        // Header as written by a machine with the other byte order
+        VectorFileHeader swapped = VectorFileHeader::describe<Tick>(1000);
+        swapped.magic = __builtin_bswap64(swapped.magic);
+        swapped.version = __builtin_bswap32(swapped.version);
+        swapped.endianMarker = __builtin_bswap32(swapped.endianMarker);
+        swapped.elemSize = __builtin_bswap32(swapped.elemSize);
+        swapped.elemAlignment = __builtin_bswap32(swapped.elemAlignment);
+        swapped.elemCount = __builtin_bswap64(swapped.elemCount);
+        swapped.payloadOffset = __builtin_bswap64(swapped.payloadOffset);
+        std::string swappedBytes = bytes;
+        std::memcpy(swappedBytes.data(), &swapped, sizeof(swapped));
+        std::stringstream swappedStream(swappedBytes);
+        REQUIRE_THROWS_WITH_AS(readVector<Tick>(swappedStream), "Serialized vector has a different byte order",
+                               std::runtime_error);
+
+        std::string unversioned = bytes;
+        const uint32_t version = 0;
+        std::memcpy(unversioned.data() + offsetof(VectorFileHeader, version), &version, sizeof(version));
+        std::stringstream unversionedStream(unversioned);
+        REQUIRE_THROWS_WITH_AS(readVector<Tick>(unversionedStream), "Serialized vector header is corrupt",
+                               std::runtime_error);
+
+        std::stringstream truncatedStream(bytes.substr(0, bytes.size() - 1));
+        Vector<Tick> truncated{Tick{1, 1.0, 1}};
+        REQUIRE_THROWS_AS(readVector(truncatedStream, truncated), std::runtime_error);
+        REQUIRE(truncated.empty());
+
+        std::stringstream garbageStream(std::string(100, 'x'));
+        REQUIRE_THROWS_AS(readVector<Tick>(garbageStream), std::runtime_error);
+
+        // A forged count doesn't allocate more than the stream delivers
+        VectorFileHeader forged = VectorFileHeader::describe<int>(size_t{1} << 45);
+        std::string forgedBytes((const char *) &forged, sizeof(forged));
+        forgedBytes.append(4, '\0');
+        std::stringstream forgedStream(forgedBytes);
+        REQUIRE_THROWS_AS(readVector<int>(forgedStream), std::runtime_error);
+    }
+
+    SUBCASE("Padded payload") {
+        VectorFileHeader header = VectorFileHeader::describe<int>(2);
+        header.payloadOffset = 128;
+        const int values[] = {7, 8};
+
+        Vector<std::byte> region;
+        region.resize(128 + sizeof(values));
+        std::memcpy(region.data(), &header, sizeof(header));
+        std::memcpy(region.data() + 128, values, sizeof(values));
+
+        std::stringstream paddedStream(std::string((const char *) region.data(), region.size()));
+        Vector<int> read = readVector<int>(paddedStream);
+        VectorView<int> view(std::span<const std::byte>(region.data(), region.size()));
+        bool check = read.size() == 2 && read[0] == 7 && read[1] == 8 && view.size() == 2 && view[1] == 8;
+        REQUIRE(check);
+
+        // Mapped vectors keep their elements right behind the header
+        const std::string path = (std::filesystem::temp_directory_path() /
+                                  ("padded_vector_test_" + std::to_string(getpid()))).string();
+        {
+            std::ofstream file(path, std::ios::binary);
+            file.write((const char *) region.data(), (std::streamsize) region.size());
+        }
+
+        REQUIRE_THROWS_AS(MappedVector<int>{path}, std::runtime_error);
+        std::filesystem::remove(path);
+    }
+
+    SUBCASE("View") {
+        // std::string only guarantees the alignment of new
+        Vector<std::byte> region;
+        region.resize_for_overwrite(bytes.size());
+        std::memcpy(region.data(), bytes.data(), bytes.size());
+
+        VectorView<Tick> view(std::span<const std::byte>(region.data(), region.size()));
+        bool check = view.size() == 1000 && view[10].volume == 10 && view.back().timestamp == 999 &&
+                     std::equal(view.begin(), view.end(), ticks.begin(), [](const Tick &lhs, const Tick &rhs) {
+                         return lhs.timestamp == rhs.timestamp && lhs.price == rhs.price;
+                     });
+        REQUIRE(check);
+        REQUIRE_THROWS_AS(view.at(1000), std::out_of_range);
+
+        REQUIRE_THROWS_AS(VectorView<Tick>(std::span<const std::byte>(region.data(), region.size() - 1)),
+                          std::runtime_error);
+        REQUIRE_THROWS_AS(VectorView<int>(std::span<const std::byte>(region.data(), region.size())),
+                          std::runtime_error);
+    }
+
+    SUBCASE("Mapped file") {
+        const std::string path = (std::filesystem::temp_directory_path() /
+                                  ("serialized_vector_test_" + std::to_string(getpid()))).string();
+        std::filesystem::remove(path);
+
+        {
+            MappedVector<Tick> mapped(path);
+
+            for (const Tick &tick: ticks) {
+                mapped.push_back(tick);
+            }
+        }
+
+        const int fd = open(path.c_str(), O_RDONLY);
+        REQUIRE(fd >= 0);
+        const size_t fileBytes = std::filesystem::file_size(path);
+        void *mapping = mmap(nullptr, fileBytes, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        REQUIRE(mapping != MAP_FAILED);
+
+        VectorView<Tick> view(std::span<const std::byte>((const std::byte *) mapping, fileBytes));
+        bool check = view.size() == 1000 && view[999].timestamp == 999 && view.front().price == 0.0;
+        REQUIRE(check);
+
+        munmap(mapping, fileBytes);
+        std::filesystem::remove(path);
+    }
+}